@@ -17,6 +17,19 @@ namespace VerifyTAPN {
 	static const std::string FACTORY_OPTION = "factory";
 	static const std::string XML_TRACE_OPTION = "xml-trace";
 	static const std::string INCLUSION_PLACES = "inc-places";
+	static const std::string CHECKPOINT_OPTION = "checkpoint";
+	static const std::string RESUME_OPTION = "resume";
+	static const std::string PROGRESS_OPTION = "progress-interval";
+	static const std::string JSON_PROGRESS_OPTION = "json-progress";
+	static const std::string STATISTICS_OPTION = "transition-stats";
+	static const std::string PARTIAL_ORDER_OPTION = "partial-order";
+	static const std::string EXACT_PASSED_LIST_OPTION = "exact-passed-list";
+	static const std::string INCLUSION_WINDOW_OPTION = "inclusion-window";
+	static const std::string KEEP_EXPANDED_OPTION = "keep-expanded";
+	static const std::string SLICING_OPTION = "slice";
+	static const std::string STATE_EQUATION_OPTION = "disable-state-equation";
+	static const std::string UNTIMED_MARKINGS_OPTION = "untimed-markings";
+	static const std::string TIME_IRRELEVANT_OPTION = "time-irrelevant-places";
 
 	std::ostream& operator<<(std::ostream& out, const Switch& flag)
 	{
@@ -139,16 +152,31 @@ namespace VerifyTAPN {
 		//       Each line in the description is assumed to fit within the remaining width
 		//       of the console, so keep descriptions short, or implement manual word-wrapping :).
 		parsers.push_back(boost::make_shared<SwitchWithArg>("k", KBOUND_OPTION, "Max tokens to use during exploration.",0));
-		parsers.push_back(boost::make_shared<SwitchWithArg>("o", SEARCH_OPTION, "Specify the desired search strategy.\n - 0: Breadth-First Search\n - 1: Depth-First Search\n - 2: Random Search\n - 3: Maximum Cover Search",3));
+		parsers.push_back(boost::make_shared<SwitchWithArg>("o", SEARCH_OPTION, "Specify the desired search strategy.\n - 0: Breadth-First Search\n - 1: Depth-First Search\n - 2: Random Search\n - 3: Maximum Cover Search\n - 4: Query Distance Search",3));
 		parsers.push_back(boost::make_shared<SwitchWithArg>("t", TRACE_OPTION, "Specify the desired trace option.\n - 0: none\n - 1: some",0));
 
 		parsers.push_back(boost::make_shared<Switch>("g",MAX_CONSTANT_OPTION, "Use global maximum constant for \nextrapolation (as opposed to local \nconstants)."));
 		parsers.push_back(boost::make_shared<Switch>("u",UNTIMED_PLACES_OPTION, "Disables the untimed place optimization."));
 		parsers.push_back(boost::make_shared<Switch>("s",SYMMETRY_OPTION, "Disables symmetry reduction."));
+		parsers.push_back(boost::make_shared<Switch>("a",PARTIAL_ORDER_OPTION, "Enables partial order reduction."));
+		parsers.push_back(boost::make_shared<Switch>("d",STATE_EQUATION_OPTION, "Disables answering queries by the untimed\nstate equation before the search."));
+		parsers.push_back(boost::make_shared<Switch>("l",SLICING_OPTION, "Remove the transitions that cannot affect\nthe places in the query before the search."));
+		parsers.push_back(boost::make_shared<Switch>("y",TIME_IRRELEVANT_OPTION, "Ignore the ages of tokens in places that\ncannot affect the places in the query\n(not with -u or traces)."));
 
 		parsers.push_back(boost::make_shared<Switch>("x",XML_TRACE_OPTION, "Output trace in xml format for TAPAAL."));
 
+		parsers.push_back(boost::make_shared<Switch>("m", EXACT_PASSED_LIST_OPTION, "Store passed markings in a hash table keyed\non both the discrete part and the zone,\nonly detecting exact duplicates."));
+		parsers.push_back(boost::make_shared<SwitchWithArg>("w", INCLUSION_WINDOW_OPTION, "With -m, also check inclusion against the\nlast arg stored markings with the same\ndiscrete part.",0));
+		parsers.push_back(boost::make_shared<SwitchWithArg>("n", KEEP_EXPANDED_OPTION, "Keep up to arg waiting markings in their\nexpanded form, so they need not be rebuilt\nfrom the stored marking when explored\n(only with discrete inclusion).",0));
+
+		parsers.push_back(boost::make_shared<SwitchWithArg>("b", UNTIMED_MARKINGS_OPTION, "Before the zone-based search, explore up to\narg markings of the net with time ignored,\nwhich may answer the queries already\n(0 disables this pass).",0));
+
 		parsers.push_back(boost::make_shared<SwitchWithArg>("f", FACTORY_OPTION, "Specify the desired marking factory.\n - 0: Default\n - 1: Discrete-inclusion\n - 2: Old factory",0));
+		parsers.push_back(boost::make_shared<SwitchWithArg>("c", CHECKPOINT_OPTION, "Save the search state to <query-file>.checkpoint\nevery arg seconds (0 disables checkpoints).",0));
+		parsers.push_back(boost::make_shared<Switch>("r", RESUME_OPTION, "Resume the search from <query-file>.checkpoint."));
+		parsers.push_back(boost::make_shared<SwitchWithArg>("p", PROGRESS_OPTION, "Report search progress on stderr every\narg seconds (0 disables reports).",0));
+		parsers.push_back(boost::make_shared<Switch>("j", JSON_PROGRESS_OPTION, "Write progress reports as JSON lines."));
+		parsers.push_back(boost::make_shared<SwitchWithArg>("e", STATISTICS_OPTION, "Export per-transition statistics to\n<query-file>.transitions.csv/.json.\n - 0: none\n - 1: CSV\n - 2: JSON",0));
 		parsers.push_back(boost::make_shared<SwitchWithStringArg>("i", INCLUSION_PLACES, "Specify a list of places to consider \nfor discrete inclusion. No spaces after\nthe commas!\nSpecial values: *ALL*, *NONE*", "*ALL*"));
 	};
 
@@ -270,6 +298,7 @@ namespace VerifyTAPN {
 		case 1:	return DEPTHFIRST;
 		case 2: return RANDOM;
 		case 3: return COVERMOST;
+		case 4: return QUERYDISTANCE;
 		default:
 			std::cout << "Unknown search strategy specified." << std::endl;
 			exit(1);
@@ -299,6 +328,18 @@ namespace VerifyTAPN {
 		}
 	}
 
+	StatisticsFormat intToStatisticsFormat(unsigned int i) {
+		switch(i)
+		{
+		case 0: return NO_STATISTICS;
+		case 1: return CSV_STATISTICS;
+		case 2: return JSON_STATISTICS;
+		default:
+			std::cout << "Unknown statistics format specified." << std::endl;
+			exit(1);
+		}
+	}
+
 	unsigned int ArgsParser::TryParseInt(const option& option) const
 	{
 		unsigned int result = 0;
@@ -349,6 +390,45 @@ namespace VerifyTAPN {
 
 		assert(map.find(INCLUSION_PLACES) != map.end());
 		std::vector<std::string> inc_places = ParseIncPlaces(map.find(INCLUSION_PLACES)->second);
-		return VerificationOptions(modelFile, queryFile, search, kbound, !disable_symmetry, trace, xml_trace, !disable_untimed_places, max_constant, factory, inc_places);
+
+		assert(map.find(CHECKPOINT_OPTION) != map.end());
+		unsigned int checkpoint = TryParseInt(*map.find(CHECKPOINT_OPTION));
+
+		assert(map.find(RESUME_OPTION) != map.end());
+		bool resume = boost::lexical_cast<bool>(map.find(RESUME_OPTION)->second);
+
+		assert(map.find(PROGRESS_OPTION) != map.end());
+		unsigned int progress = TryParseInt(*map.find(PROGRESS_OPTION));
+
+		assert(map.find(JSON_PROGRESS_OPTION) != map.end());
+		bool json_progress = boost::lexical_cast<bool>(map.find(JSON_PROGRESS_OPTION)->second);
+
+		assert(map.find(STATISTICS_OPTION) != map.end());
+		StatisticsFormat statistics = intToStatisticsFormat(TryParseInt(*map.find(STATISTICS_OPTION)));
+
+		assert(map.find(PARTIAL_ORDER_OPTION) != map.end());
+		bool partial_order = boost::lexical_cast<bool>(map.find(PARTIAL_ORDER_OPTION)->second);
+
+		assert(map.find(EXACT_PASSED_LIST_OPTION) != map.end());
+		bool exact_passed_list = boost::lexical_cast<bool>(map.find(EXACT_PASSED_LIST_OPTION)->second);
+
+		assert(map.find(INCLUSION_WINDOW_OPTION) != map.end());
+		unsigned int inclusion_window = TryParseInt(*map.find(INCLUSION_WINDOW_OPTION));
+
+		assert(map.find(KEEP_EXPANDED_OPTION) != map.end());
+		unsigned int keep_expanded = TryParseInt(*map.find(KEEP_EXPANDED_OPTION));
+
+		assert(map.find(SLICING_OPTION) != map.end());
+		bool slicing = boost::lexical_cast<bool>(map.find(SLICING_OPTION)->second);
+
+		assert(map.find(STATE_EQUATION_OPTION) != map.end());
+		bool disable_state_equation = boost::lexical_cast<bool>(map.find(STATE_EQUATION_OPTION)->second);
+
+		assert(map.find(UNTIMED_MARKINGS_OPTION) != map.end());
+		unsigned int untimed_markings = TryParseInt(*map.find(UNTIMED_MARKINGS_OPTION));
+
+		assert(map.find(TIME_IRRELEVANT_OPTION) != map.end());
+		bool time_irrelevant_places = boost::lexical_cast<bool>(map.find(TIME_IRRELEVANT_OPTION)->second);
+		return VerificationOptions(modelFile, queryFile, search, kbound, !disable_symmetry, trace, xml_trace, !disable_untimed_places, max_constant, factory, inc_places, checkpoint, resume, progress, json_progress, statistics, partial_order, exact_passed_list, inclusion_window, keep_expanded, slicing, !disable_state_equation, untimed_markings, time_irrelevant_places);
 	}
 }
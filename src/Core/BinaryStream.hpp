@@ -0,0 +1,70 @@
+#ifndef BINARYSTREAM_HPP_
+#define BINARYSTREAM_HPP_
+
+#include <iostream>
+#include <vector>
+#include <string>
+
+namespace VerifyTAPN {
+	// Thin wrappers for writing/reading plain values to/from a binary stream.
+	// Values are written one at a time straight to the underlying stream, so
+	// large structures can be saved without building a copy in memory first.
+	class BinaryWriter {
+	public:
+		explicit BinaryWriter(std::ostream& out) : out(out) { };
+
+	public:
+		template<typename T>
+		inline void Write(const T& value)
+		{
+			out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+		};
+
+		template<typename T>
+		inline void WriteVector(const std::vector<T>& vec)
+		{
+			Write<unsigned int>(vec.size());
+			if(!vec.empty()) out.write(reinterpret_cast<const char*>(&vec[0]), vec.size()*sizeof(T));
+		};
+
+		inline void WriteArray(const void* data, unsigned int bytes)
+		{
+			out.write(reinterpret_cast<const char*>(data), bytes);
+		};
+
+		inline bool Good() const { return out.good(); };
+	private:
+		std::ostream& out;
+	};
+
+	class BinaryReader {
+	public:
+		explicit BinaryReader(std::istream& in) : in(in) { };
+
+	public:
+		template<typename T>
+		inline T Read()
+		{
+			T value;
+			ReadArray(&value, sizeof(T));
+			return value;
+		};
+
+		template<typename T>
+		inline void ReadVector(std::vector<T>& vec)
+		{
+			vec.resize(Read<unsigned int>());
+			if(!vec.empty()) ReadArray(&vec[0], vec.size()*sizeof(T));
+		};
+
+		inline void ReadArray(void* data, unsigned int bytes)
+		{
+			in.read(reinterpret_cast<char*>(data), bytes);
+			if(!in.good()) throw std::string("unexpected end of file");
+		};
+	private:
+		std::istream& in;
+	};
+}
+
+#endif /* BINARYSTREAM_HPP_ */
@@ -1,4 +1,5 @@
 #include "IndirectionTable.hpp"
+#include "BinaryStream.hpp"
 #include <iostream>
 
 namespace VerifyTAPN
@@ -13,6 +14,28 @@ namespace VerifyTAPN
 		}
 	}
 
+	void IndirectionTable::Write(BinaryWriter& out) const
+	{
+		out.Write<unsigned int>(map.size());
+		typedef BiMap::left_const_iterator const_iterator;
+		for( const_iterator iter = map.left.begin(), iend = map.left.end(); iter != iend; ++iter )
+		{
+			out.Write<unsigned int>(iter->first);
+			out.Write<unsigned int>(iter->second);
+		}
+	}
+
+	void IndirectionTable::Read(BinaryReader& in)
+	{
+		map.clear();
+		unsigned int size = in.Read<unsigned int>();
+		for(unsigned int i = 0; i < size; i++)
+		{
+			unsigned int from = in.Read<unsigned int>();
+			AddMapping(from, in.Read<unsigned int>());
+		}
+	}
+
 	std::ostream& operator<<(std::ostream& out, const IndirectionTable& t)
 	{
 		t.Print(out);
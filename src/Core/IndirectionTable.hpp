@@ -6,6 +6,9 @@
 
 namespace VerifyTAPN
 {
+	class BinaryWriter;
+	class BinaryReader;
+
 	class IndirectionTable
 	{
 	public:
@@ -47,6 +50,8 @@ namespace VerifyTAPN
 
 		unsigned int Size() const { return map.size(); };
 		void Print(std::ostream& out) const;
+		void Write(BinaryWriter& out) const;
+		void Read(BinaryReader& in);
 	private:
 		BiMap map;
 	};
@@ -0,0 +1,104 @@
+#ifndef PROFILER_HPP_
+#define PROFILER_HPP_
+
+#include <iostream>
+
+// Per-phase timers and counters for the exploration loop. They are compiled in
+// only when VERIFYTAPN_PROFILE is defined (cmake -DVERIFYTAPN_Profile=ON);
+// otherwise the PROFILE_* macros expand to nothing.
+#ifdef VERIFYTAPN_PROFILE
+
+#include <chrono>
+#include <iomanip>
+
+namespace VerifyTAPN {
+	namespace Profiling {
+		enum Phase {
+			NEXT_UNEXPLORED,
+			SUCCESSOR_GENERATION,
+			DELAY,
+			EXTRAPOLATE,
+			MAKE_SYMMETRIC,
+			TRACE_STORE,
+			PWLIST_ADD,
+			CONVERT,
+			INCLUSION_CHECK,
+			QUERY_CHECK,
+			NUMBER_OF_PHASES
+		};
+
+		enum Event {
+			RELATION_CHECKS,
+			SUBSUMED,
+			COVERED,
+			UNSTORED_QUERY_CHECKS,
+			NUMBER_OF_EVENTS
+		};
+
+		struct Timer {
+			long long calls;
+			long long nanoseconds;
+		};
+
+		inline Timer* Timers() { static Timer timers[NUMBER_OF_PHASES]; return timers; };
+		inline long long* Events() { static long long events[NUMBER_OF_EVENTS]; return events; };
+
+		class ScopedTimer {
+		public:
+			explicit ScopedTimer(Phase phase) : phase(phase), start(std::chrono::steady_clock::now()) { };
+			~ScopedTimer()
+			{
+				Timer& timer = Timers()[phase];
+				timer.calls++;
+				timer.nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+			};
+		private:
+			Phase phase;
+			std::chrono::steady_clock::time_point start;
+		};
+
+		inline void Print(std::ostream& out)
+		{
+			static const char* phases[NUMBER_OF_PHASES] = {
+				"next unexplored", "successor generation", "delay", "extrapolate", "make symmetric",
+				"trace store", "pwlist add", "  convert", "  inclusion check", "query check"
+			};
+			static const char* events[NUMBER_OF_EVENTS] = { "relation checks", "subsumed", "covered", "unstored query checks" };
+
+			std::ios::fmtflags flags = out.flags();
+			std::streamsize precision = out.precision();
+			out << "PROFILE" << std::endl;
+			for(unsigned int i = 0; i < NUMBER_OF_PHASES; i++)
+			{
+				const Timer& timer = Timers()[i];
+				out << "  " << std::left << std::setw(24) << phases[i] << std::right << std::setw(12) << timer.calls << " calls"
+					<< std::setw(12) << std::fixed << std::setprecision(1) << timer.nanoseconds / 1e6 << " ms" << std::endl;
+			}
+			for(unsigned int i = 0; i < NUMBER_OF_EVENTS; i++)
+			{
+				out << "  " << std::left << std::setw(24) << events[i] << std::right << std::setw(12) << Events()[i] << std::endl;
+			}
+			out << std::endl;
+			out.flags(flags);
+			out.precision(precision);
+		};
+	}
+}
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(phase) VerifyTAPN::Profiling::ScopedTimer PROFILE_CONCAT(profileTimer, __LINE__)(VerifyTAPN::Profiling::phase)
+#define PROFILE_COUNT(event) (VerifyTAPN::Profiling::Events()[VerifyTAPN::Profiling::event]++)
+#define PROFILE_PRINT(out) VerifyTAPN::Profiling::Print(out)
+
+#else
+
+// PROFILE_COUNT and PROFILE_PRINT still expand to an expression, so they can be
+// the body of an if
+#define PROFILE_SCOPE(phase)
+#define PROFILE_COUNT(event) ((void)0)
+#define PROFILE_PRINT(out) ((void)0)
+
+#endif
+
+#endif /* PROFILER_HPP_ */
@@ -0,0 +1,149 @@
+#include "QueryDistanceVisitor.hpp"
+#include "AST.hpp"
+#include "../SymbolicMarking/StoredMarking.hpp"
+#include <exception>
+#include <limits>
+#include <algorithm>
+#include <cstdlib>
+#include <cassert>
+
+namespace VerifyTAPN
+{
+	namespace AST
+	{
+		// distance of an unsatisfiable proposition; small enough that sums of two do not overflow
+		static const int UNREACHABLE = std::numeric_limits<int>::max() / 4;
+
+		QueryDistanceVisitor::QueryDistanceVisitor(const Query& query, bool negate) : program(), stack(), negated(negate), depth(0), maxDepth(0)
+		{
+			boost::any any;
+			query.Accept(*this, any);
+			assert(depth == 1);
+			stack.resize(maxDepth);
+		}
+
+		int QueryDistanceVisitor::Distance(const StoredMarking& marking) const
+		{
+			int* top = &stack[0]; // one past the topmost value
+			for(std::vector<Instruction>::const_iterator pc = program.begin(); pc != program.end(); ++pc)
+			{
+				int diff = 0;
+				if(pc->op >= LESS && pc->op <= NOT_EQUAL)
+				{
+					top--;
+					diff = top[-1] - top[0];
+				}
+
+				switch(pc->op)
+				{
+				case PUSH_CONSTANT: *top++ = pc->arg; break;
+				case PUSH_PLACE: *top++ = static_cast<int>(marking.NumberOfTokensInPlace(pc->arg)); break;
+				case ADD: top--; top[-1] = top[-1] + top[0]; break;
+				case SUBTRACT: top--; top[-1] = top[-1] - top[0]; break;
+				case MULTIPLY: top--; top[-1] = top[-1] * top[0]; break;
+				case NEGATE: top[-1] = -top[-1]; break;
+				case LESS: top[-1] = std::max(0, diff + 1); break;
+				case LESS_EQUAL: top[-1] = std::max(0, diff); break;
+				case EQUAL: top[-1] = std::abs(diff); break;
+				case GREATER_EQUAL: top[-1] = std::max(0, -diff); break;
+				case GREATER: top[-1] = std::max(0, 1 - diff); break;
+				case NOT_EQUAL: top[-1] = diff == 0 ? 1 : 0; break;
+				case SUM: top--; top[-1] = std::min(top[-1] + top[0], UNREACHABLE); break;
+				case MIN: top--; top[-1] = std::min(top[-1], top[0]); break;
+				}
+			}
+			assert(top == &stack[0] + 1);
+			return stack[0];
+		}
+
+		void QueryDistanceVisitor::Emit(OpCode op, int arg, int pushed, int popped)
+		{
+			program.push_back(Instruction(op, arg));
+			depth += pushed - popped;
+			maxDepth = std::max(maxDepth, depth);
+		}
+
+		void QueryDistanceVisitor::EmitBinary(OpCode op, const Visitable& left, const Visitable& right, boost::any& context)
+		{
+			left.Accept(*this, context);
+			right.Accept(*this, context);
+			Emit(op, 0, 1, 2);
+		}
+
+		// A negated comparison is the opposite comparison.
+		QueryDistanceVisitor::OpCode QueryDistanceVisitor::Comparison(const std::string& op) const
+		{
+			if(op == "<") return negated ? GREATER_EQUAL : LESS;
+			else if(op == "<=") return negated ? GREATER : LESS_EQUAL;
+			else if(op == "=" || op == "==") return negated ? NOT_EQUAL : EQUAL;
+			else if(op == ">=") return negated ? LESS : GREATER_EQUAL;
+			else if(op == ">") return negated ? LESS_EQUAL : GREATER;
+			else if(op == "!=") return negated ? EQUAL : NOT_EQUAL;
+			else
+				throw std::exception();
+		}
+
+		void QueryDistanceVisitor::Visit(const NotExpression& expr, boost::any& context)
+		{
+			negated = !negated;
+			expr.Child().Accept(*this, context);
+			negated = !negated;
+		}
+
+		void QueryDistanceVisitor::Visit(const OrExpression& expr, boost::any& context)
+		{
+			EmitBinary(negated ? SUM : MIN, expr.Left(), expr.Right(), context);
+		}
+
+		void QueryDistanceVisitor::Visit(const AndExpression& expr, boost::any& context)
+		{
+			EmitBinary(negated ? MIN : SUM, expr.Left(), expr.Right(), context);
+		}
+
+		void QueryDistanceVisitor::Visit(const AtomicProposition& expr, boost::any& context)
+		{
+			EmitBinary(Comparison(expr.Operator()), expr.GetLeft(), expr.GetRight(), context);
+		}
+
+		void QueryDistanceVisitor::Visit(const NumberExpression& expr, boost::any& context)
+		{
+			Emit(PUSH_CONSTANT, expr.GetValue(), 1, 0);
+		}
+
+		void QueryDistanceVisitor::Visit(const IdentifierExpression& expr, boost::any& context)
+		{
+			Emit(PUSH_PLACE, expr.GetPlace(), 1, 0);
+		}
+
+		void QueryDistanceVisitor::Visit(const MultiplyExpression& expr, boost::any& context)
+		{
+			EmitBinary(MULTIPLY, expr.GetLeft(), expr.GetRight(), context);
+		}
+
+		void QueryDistanceVisitor::Visit(const MinusExpression& expr, boost::any& context)
+		{
+			expr.GetValue().Accept(*this, context);
+			Emit(NEGATE, 0, 1, 1);
+		}
+
+		void QueryDistanceVisitor::Visit(const SubtractExpression& expr, boost::any& context)
+		{
+			EmitBinary(SUBTRACT, expr.GetLeft(), expr.GetRight(), context);
+		}
+
+		void QueryDistanceVisitor::Visit(const PlusExpression& expr, boost::any& context)
+		{
+			EmitBinary(ADD, expr.GetLeft(), expr.GetRight(), context);
+		}
+
+		void QueryDistanceVisitor::Visit(const BoolExpression& expr, boost::any& context)
+		{
+			Emit(PUSH_CONSTANT, (expr.GetValue() != negated) ? 0 : UNREACHABLE, 1, 0);
+		}
+
+		void QueryDistanceVisitor::Visit(const Query& query, boost::any& context)
+		{
+			query.Child().Accept(*this, context);
+		}
+	}
+}
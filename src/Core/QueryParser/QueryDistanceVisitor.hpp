@@ -0,0 +1,77 @@
+#ifndef QUERYDISTANCEVISITOR_HPP_
+#define QUERYDISTANCEVISITOR_HPP_
+
+#include "Visitor.hpp"
+#include <string>
+#include <vector>
+
+namespace VerifyTAPN
+{
+	class StoredMarking;
+	namespace AST
+	{
+		class Query;
+		class Visitable;
+
+		// Estimates how many tokens must be moved before a marking satisfies the
+		// proposition of a query (0 if it already does). Atomic propositions give the
+		// distance between the two sides of the comparison; conjunctions add up and
+		// disjunctions take the minimum. Negations are pushed down to the atoms.
+		//
+		// The query is visited once, when the visitor is created, and lowered to a
+		// small stack program like QueryProgram; Distance runs it on ints only, as it
+		// is called for every marking added to the waiting list.
+		class QueryDistanceVisitor : public Visitor
+		{
+		private:
+			enum OpCode {
+				PUSH_CONSTANT, PUSH_PLACE, // arg: the constant, or the place
+				ADD, SUBTRACT, MULTIPLY, NEGATE,
+				LESS, LESS_EQUAL, EQUAL, GREATER_EQUAL, GREATER, NOT_EQUAL, // replace two values by their distance
+				SUM, MIN // of two distances
+			};
+
+			struct Instruction {
+				OpCode op;
+				int arg;
+
+				Instruction(OpCode op, int arg) : op(op), arg(arg) { };
+			};
+
+		public:
+			// distance to a marking satisfying the proposition of the query, or its negation if negate is true
+			QueryDistanceVisitor(const Query& query, bool negate);
+			virtual ~QueryDistanceVisitor() {}
+
+			int Distance(const StoredMarking& marking) const;
+
+		public: // visitor methods
+			virtual void Visit(const NotExpression& expr, boost::any& context);
+			virtual void Visit(const OrExpression& expr, boost::any& context);
+			virtual void Visit(const AndExpression& expr, boost::any& context);
+			virtual void Visit(const AtomicProposition& expr, boost::any& context);
+			virtual void Visit(const BoolExpression& expr, boost::any& context);
+			virtual void Visit(const Query& query, boost::any& context);
+			virtual void Visit(const NumberExpression& expr, boost::any& context);
+			virtual void Visit(const IdentifierExpression& expr, boost::any& context);
+			virtual void Visit(const MultiplyExpression& expr, boost::any& context);
+			virtual void Visit(const MinusExpression& expr, boost::any& context);
+			virtual void Visit(const SubtractExpression& expr, boost::any& context);
+			virtual void Visit(const PlusExpression& expr, boost::any& context);
+
+		private:
+			void Emit(OpCode op, int arg, int pushed, int popped);
+			void EmitBinary(OpCode op, const Visitable& left, const Visitable& right, boost::any& context);
+			OpCode Comparison(const std::string& op) const;
+
+		private:
+			std::vector<Instruction> program;
+			mutable std::vector<int> stack; // scratch space for Distance
+			bool negated;
+			int depth;
+			int maxDepth;
+		};
+	}
+}
+
+#endif /* QUERYDISTANCEVISITOR_HPP_ */
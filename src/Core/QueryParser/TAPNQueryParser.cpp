@@ -14,12 +14,12 @@ namespace VerifyTAPN
 		return result;
 	}
 
-	void TAPNQueryParser::SetAST(AST::Query* query){
-		ast = query->clone();
+	void TAPNQueryParser::AddQuery(AST::Query* query){
+		queries.push_back(query);
 	}
 
-	AST::Query* TAPNQueryParser::GetAST(){
-		return ast;
+	const std::vector<AST::Query*>& TAPNQueryParser::GetQueries() const{
+		return queries;
 	}
 
 	void TAPNQueryParser::error(const location& l, const std::string& m)
@@ -3,6 +3,7 @@
 
 #include "Generated/parser.hpp"
 #include <string>
+#include <vector>
 #include "../TAPN/TimedArcPetriNet.hpp"
 
 # define YY_DECL                                        \
@@ -22,7 +23,7 @@ namespace VerifyTAPN
 
 	class TAPNQueryParser {
 	public:
-		TAPNQueryParser(const VerifyTAPN::TAPN::TimedArcPetriNet& tapn) : ast(NULL), net(tapn) { };
+		TAPNQueryParser(const VerifyTAPN::TAPN::TimedArcPetriNet& tapn) : queries(), net(tapn) { };
 		virtual ~TAPNQueryParser() { };
 
 	private:
@@ -31,8 +32,8 @@ namespace VerifyTAPN
 
 	public:
 		int parse(const std::string& file);
-		void SetAST(VerifyTAPN::AST::Query* ast);
-		AST::Query* GetAST();
+		void AddQuery(VerifyTAPN::AST::Query* query);
+		const std::vector<AST::Query*>& GetQueries() const; // in file order, ownership passes to the caller
 
 		const VerifyTAPN::TAPN::TimedArcPetriNet& tapn() { return net; };
 
@@ -42,7 +43,7 @@ namespace VerifyTAPN
 
 	public:
 		std::string file;
-		VerifyTAPN::AST::Query* ast;
+		std::vector<VerifyTAPN::AST::Query*> queries;
 		const VerifyTAPN::TAPN::TimedArcPetriNet& net;
 	};
 }
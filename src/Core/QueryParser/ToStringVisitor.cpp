@@ -85,10 +85,13 @@ namespace VerifyTAPN
 
 		void ToStringVisitor::Visit(const Query& query, boost::any& context)
 		{
-			if(query.GetQuantifier() == EF)
-				std::cout << "EF ";
-			else
-				std::cout << "AG ";
+			switch(query.GetQuantifier())
+			{
+			case EF: std::cout << "EF "; break;
+			case AG: std::cout << "AG "; break;
+			case EG: std::cout << "EG "; break;
+			case AF: std::cout << "AF "; break;
+			}
 
 			query.Child().Accept(*this, context);
 		}
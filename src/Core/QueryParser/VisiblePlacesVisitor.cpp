@@ -0,0 +1,70 @@
+#include "VisiblePlacesVisitor.hpp"
+
+namespace VerifyTAPN{
+	namespace AST {
+
+		void VisiblePlacesVisitor::Visit(const NotExpression& expr, boost::any& context)
+		{
+			expr.Child().Accept(*this, context);
+		}
+
+		void VisiblePlacesVisitor::Visit(const OrExpression& expr, boost::any& context)
+		{
+			expr.Left().Accept(*this, context);
+			expr.Right().Accept(*this, context);
+		}
+
+		void VisiblePlacesVisitor::Visit(const AndExpression& expr, boost::any& context)
+		{
+			expr.Left().Accept(*this, context);
+			expr.Right().Accept(*this, context);
+		}
+
+		void VisiblePlacesVisitor::Visit(const AtomicProposition& expr, boost::any& context)
+		{
+			expr.GetLeft().Accept(*this, context);
+			expr.GetRight().Accept(*this, context);
+		}
+
+		void VisiblePlacesVisitor::Visit(const BoolExpression& expr, boost::any& context)
+		{
+		}
+
+		void VisiblePlacesVisitor::Visit(const Query& query, boost::any& context)
+		{
+			query.Child().Accept(*this, context);
+		}
+
+		void VisiblePlacesVisitor::Visit(const NumberExpression& expr, boost::any& context)
+		{
+		}
+
+		void VisiblePlacesVisitor::Visit(const IdentifierExpression& expr, boost::any& context)
+		{
+			visiblePlaces.push_back(expr.GetPlace());
+		}
+
+		void VisiblePlacesVisitor::Visit(const MultiplyExpression& expr, boost::any& context)
+		{
+			expr.GetLeft().Accept(*this, context);
+			expr.GetRight().Accept(*this, context);
+		}
+
+		void VisiblePlacesVisitor::Visit(const MinusExpression& expr, boost::any& context)
+		{
+			expr.GetValue().Accept(*this, context);
+		}
+
+		void VisiblePlacesVisitor::Visit(const SubtractExpression& expr, boost::any& context)
+		{
+			expr.GetLeft().Accept(*this, context);
+			expr.GetRight().Accept(*this, context);
+		}
+
+		void VisiblePlacesVisitor::Visit(const PlusExpression& expr, boost::any& context)
+		{
+			expr.GetLeft().Accept(*this, context);
+			expr.GetRight().Accept(*this, context);
+		}
+	}
+}
@@ -0,0 +1,40 @@
+#ifndef VISIBLEPLACESVISITOR_HPP_
+#define VISIBLEPLACESVISITOR_HPP_
+
+#include <vector>
+#include "Visitor.hpp"
+#include "AST.hpp"
+
+namespace VerifyTAPN {
+	namespace AST {
+
+		// Collects the indices of all places mentioned in a query, i.e. the places
+		// whose token counts can change the truth value of the query.
+		class VisiblePlacesVisitor : public Visitor
+		{
+		public:
+			VisiblePlacesVisitor() : visiblePlaces() { };
+			virtual ~VisiblePlacesVisitor() {};
+			virtual void Visit(const NotExpression& expr, boost::any& context);
+			virtual void Visit(const OrExpression& expr, boost::any& context);
+			virtual void Visit(const AndExpression& expr, boost::any& context);
+			virtual void Visit(const AtomicProposition& expr, boost::any& context);
+			virtual void Visit(const BoolExpression& expr, boost::any& context);
+			virtual void Visit(const Query& query, boost::any& context);
+			virtual void Visit(const NumberExpression& expr, boost::any& context);
+			virtual void Visit(const IdentifierExpression& expr, boost::any& context);
+			virtual void Visit(const MultiplyExpression& expr, boost::any& context);
+			virtual void Visit(const MinusExpression& expr, boost::any& context);
+			virtual void Visit(const SubtractExpression& expr, boost::any& context);
+			virtual void Visit(const PlusExpression& expr, boost::any& context);
+
+			void FindVisiblePlaces(const Query& query){ boost::any any; query.Accept(*this, any); };
+			inline const std::vector<int>& GetVisiblePlaces() const { return visiblePlaces; };
+		private:
+			std::vector<int> visiblePlaces;
+		};
+
+	}
+}
+
+#endif /* VISIBLEPLACESVISITOR_HPP_ */
@@ -1,5 +1,7 @@
 %{                                            /* -*- C++ -*- */
 # include <string>
+# include <fstream>
+# include <iterator>
 # include "../TAPNQueryParser.hpp"
 # include "parser.hpp"
  
@@ -39,6 +41,8 @@ blank [ \t]
 [0-9]+						{ yylval->number = atoi(yytext); return token::NUMBER; }
 ^EF							{ return token::EF; }
 ^AG							{ return token::AG; }
+^EG							{ return token::EG; }
+^AF							{ return token::AF; }
 or|\|\|						{ return token::OR; }
 and|&&						{ return token::AND; }
 true						{ return token::BOOL_TRUE; }
@@ -61,19 +65,25 @@ false						{ return token::BOOL_FALSE; }
 %%
 namespace VerifyTAPN
 {
+	// the whole file is scanned from memory rather than read through stdio
+	static YY_BUFFER_STATE buffer;
+
 	void TAPNQueryParser::scan_begin ()
 	{
-		if (!(yyin = fopen (file.c_str (), "r")))
+		std::ifstream in (file.c_str (), std::ios::in | std::ios::binary);
+		if (!in)
 		{
 			error (std::string ("cannot open ") + file);
 			std::cout << errno;
 			exit (1);
 		}
+		std::string contents ((std::istreambuf_iterator<char> (in)), std::istreambuf_iterator<char> ());
+		buffer = yy_scan_bytes (contents.data (), contents.size ());
 	}
 	     
 	void TAPNQueryParser::scan_end ()
 	{
-		fclose (yyin);
+		yy_delete_buffer (buffer);
 	}
 }
 
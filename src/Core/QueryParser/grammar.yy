@@ -42,7 +42,7 @@ namespace VerifyTAPN{
 %token <string> IDENTIFIER LESS LESSEQUAL EQUAL GREATEREQUAL GREATER
 %token <number> NUMBER    
 %token END      0
-%token EF AG
+%token EF AG EG AF
 %token LPARAN RPARAN
 %token OR AND NOT
 %token BOOL_TRUE BOOL_FALSE
@@ -57,9 +57,15 @@ namespace VerifyTAPN{
 %destructor { delete $$; } query
 
 %%
-%start query;
-query				: EF expression { $$ = new VerifyTAPN::AST::Query(VerifyTAPN::AST::EF, $2); driver.SetAST($$); }
-					| AG expression { $$ = new VerifyTAPN::AST::Query(VerifyTAPN::AST::AG, $2); driver.SetAST($$); }
+%start queries;
+queries				: query { driver.AddQuery($1); }
+					| queries query { driver.AddQuery($2); }
+;
+
+query				: EF expression { $$ = new VerifyTAPN::AST::Query(VerifyTAPN::AST::EF, $2); }
+					| AG expression { $$ = new VerifyTAPN::AST::Query(VerifyTAPN::AST::AG, $2); }
+					| EG expression { $$ = new VerifyTAPN::AST::Query(VerifyTAPN::AST::EG, $2); }
+					| AF expression { $$ = new VerifyTAPN::AST::Query(VerifyTAPN::AST::AF, $2); }
 ;
 
 expression			: parExpression { $$ = $1; }
@@ -88,7 +94,7 @@ arithmeticParantheses	: LPARAN arithmeticExpression RPARAN	{ $$ = $2; }
                         | IDENTIFIER                            { 
                                                                     int placeIndex = driver.net.GetPlaceIndex(*$1);
                                                                     delete $1;
-                                                                    if(placeIndex == -1) error(@1, "unknown place"); 
+                                                                    if(placeIndex == -1) { error(@1, "unknown place"); YYERROR; }
                                                                     $$ = new VerifyTAPN::AST::IdentifierExpression(placeIndex); 
                                                                  }
                         ;
@@ -111,5 +117,4 @@ VerifyTAPN::Parser::error (const VerifyTAPN::Parser::location_type& l,
                         const std::string& m)
 {
 	driver.error (l, m);
-	exit(1);
 }
@@ -7,9 +7,13 @@
 #include "../../typedefs.hpp"
 #include <iosfwd>
 #include <set>
+#include <vector>
+#include <utility>
 
 namespace VerifyTAPN {
 	class AbstractMarking {
+	public:
+		typedef std::vector< std::pair<int, const TAPN::TimeInterval*> > GuardList; // (token, guard of the arc consuming it)
 	public:
 		virtual ~AbstractMarking() { };
 
@@ -21,7 +25,9 @@ namespace VerifyTAPN {
 		virtual void Reset(int token) = 0;
 		virtual void Constrain(int token, const TAPN::TimeInterval& interval) = 0; // not sure if this should be here?
 		virtual void Constrain(int token, const TAPN::TimeInvariant& invariant) = 0; // not sure if this should be here?
+		virtual void Constrain(const GuardList& guards) = 0; // all guards at once, closing the zone only once
 		virtual bool PotentiallySatisfies(int token, const TAPN::TimeInterval& interval) const = 0;
+		virtual bool PotentiallySatisfies(int token, const TAPN::TimeInterval& interval, int other, const TAPN::TimeInterval& otherInterval) const = 0;
 
 		// discrete part
 		virtual void MoveToken(int tokenIndex, int newPlaceIndex) = 0;
@@ -168,6 +168,109 @@ namespace VerifyTAPN
 				|| (placeUpper == pivot && dbm(0,mapUpper) == dbm(0,mapPivot) && dbm(mapUpper,0) == dbm(mapPivot,0) && (mapPivot > mapUpper ? dbm(mapPivot,mapUpper) > dbm(mapUpper,mapPivot) : dbm(mapUpper,mapPivot) > dbm(mapPivot,mapUpper)));
 	}
 
+	// Applies the lower and upper bound of every guard as one batch of constraints,
+	// so the DBM is closed once instead of once per bound.
+	void DBMMarking::Constrain(const GuardList& guards)
+	{
+		static std::vector<constraint_t> constraints;
+		constraints.clear();
+		for(GuardList::const_iterator it = guards.begin(); it != guards.end(); ++it)
+		{
+			unsigned int clock = mapping.GetMapping(it->first);
+			constraints.push_back(constraint_t(0, clock, it->second->LowerBoundToDBMRaw()));
+			if(it->second->GetUpperBound() != std::numeric_limits<int>::max())
+				constraints.push_back(constraint_t(clock, 0, it->second->UpperBoundToDBMRaw()));
+		}
+		if(!constraints.empty()) dbm.constrain(&constraints[0], constraints.size());
+	}
+
+	void DBMMarking::ConstrainInvariants()
+	{
+		static std::vector<constraint_t> constraints;
+		constraints.clear();
+		for(unsigned int i = 0; i < NumberOfTokens(); i++)
+		{
+			const TAPN::TimeInvariant& invariant = tapn->GetPlace(GetTokenPlacement(i)).GetInvariant();
+			if(invariant.GetBound() != std::numeric_limits<int>::max())
+				constraints.push_back(constraint_t(mapping.GetMapping(i), 0, dbm_boundbool2raw(invariant.GetBound(), invariant.IsBoundStrict())));
+		}
+		if(!constraints.empty()) dbm.constrain(&constraints[0], constraints.size());
+	}
+
+	// Checks whether both tokens can be inside their intervals at the same time,
+	// i.e. whether the zone allows lower - otherUpper <= x - y <= upper - otherLower.
+	bool DBMMarking::PotentiallySatisfies(int token, const TAPN::TimeInterval& interval, int other, const TAPN::TimeInterval& otherInterval) const
+	{
+		unsigned int x = mapping.GetMapping(token);
+		unsigned int y = mapping.GetMapping(other);
+		if(interval.GetUpperBound() != std::numeric_limits<int>::max())
+		{
+			raw_t bound = dbm_boundbool2raw(interval.GetUpperBound() - otherInterval.GetLowerBound(), interval.IsUpperBoundStrict() || otherInterval.IsLowerBoundStrict());
+			if(!dbm.satisfies(x, y, bound)) return false;
+		}
+		if(otherInterval.GetUpperBound() != std::numeric_limits<int>::max())
+		{
+			raw_t bound = dbm_boundbool2raw(otherInterval.GetUpperBound() - interval.GetLowerBound(), otherInterval.IsUpperBoundStrict() || interval.IsLowerBoundStrict());
+			if(!dbm.satisfies(y, x, bound)) return false;
+		}
+		return true;
+	}
+
+	// Two tokens are equivalent if they are in the same place and swapping
+	// their clocks leaves the DBM unchanged.
+	bool DBMMarking::AreTokensEquivalent(int token, int other) const
+	{
+		if(GetTokenPlacement(token) != GetTokenPlacement(other)) return false;
+
+		unsigned int i = mapping.GetMapping(token);
+		unsigned int j = mapping.GetMapping(other);
+		if(dbm(0,i) != dbm(0,j) || dbm(i,0) != dbm(j,0) || dbm(i,j) != dbm(j,i)) return false;
+
+		for(unsigned int k = 1; k < dbm.getDimension(); k++)
+		{
+			if(k == i || k == j) continue;
+			if(dbm(i,k) != dbm(j,k) || dbm(k,i) != dbm(k,j)) return false;
+		}
+		return true;
+	}
+
+	// Subtracts the zones one at a time, keeping the remainder as a list of DBMs:
+	// removing a zone Z from a DBM D leaves D with the negation of the first bound
+	// of Z, D with that bound and the negation of the second, and so on. Gives up,
+	// returning true, once the remainder splits into too many DBMs.
+	bool DBMMarking::IsCoveredBy(const std::vector<SymbolicMarking*>& zones) const
+	{
+		static const unsigned int MAX_PIECES = 256;
+		unsigned int dim = dbm.getDimension();
+
+		std::vector<dbm::dbm_t> remainder(1, dbm);
+		for(std::vector<SymbolicMarking*>::const_iterator zone = zones.begin(); zone != zones.end() && !remainder.empty(); ++zone)
+		{
+			const dbm::dbm_t& other = static_cast<const DBMMarking*>(*zone)->dbm;
+			std::vector<dbm::dbm_t> next;
+			for(std::vector<dbm::dbm_t>::const_iterator piece = remainder.begin(); piece != remainder.end(); ++piece)
+			{
+				dbm::dbm_t inside(*piece);
+				for(unsigned int i = 0; i < dim && !inside.isEmpty(); i++)
+				{
+					for(unsigned int j = 0; j < dim && !inside.isEmpty(); j++)
+					{
+						raw_t bound = other(i,j);
+						if(i == j || bound == dbm_LS_INFINITY || inside(i,j) <= bound) continue;
+
+						dbm::dbm_t outside(inside);
+						if(outside.constrain(j, i, dbm_bound2raw(-dbm_raw2bound(bound), dbm_rawIsStrict(bound) ? dbm_WEAK : dbm_STRICT)))
+							next.push_back(outside);
+						inside.constrain(i, j, bound);
+					}
+				}
+				if(next.size() > MAX_PIECES) return true;
+			}
+			remainder.swap(next);
+		}
+		return remainder.empty();
+	}
+
 	void DBMMarking::Swap(int i, int j)
 	{
 		DiscreteMarking::Swap(i,j);
@@ -24,19 +24,28 @@ namespace VerifyTAPN {
 
 		virtual id_type UniqueId() const { return id; };
 		virtual size_t HashKey() const { return VerifyTAPN::hash()(dp); };
+		virtual size_t ExactHashKey() const
+		{
+			size_t seed = HashKey();
+			boost::hash_combine(seed, dbm.hash());
+			return seed;
+		};
+		virtual bool Equals(const StoredMarking& other) const
+		{
+			const DBMMarking& marking = static_cast<const DBMMarking&>(other);
+			return VerifyTAPN::eqdp()(dp, marking.dp) && mapping == marking.mapping && dbm == marking.dbm;
+		};
+		virtual unsigned int NumberOfTokensInPlace(int placeIndex) const { return DiscreteMarking::NumberOfTokensInPlace(placeIndex); };
 
 		virtual void Reset(int token) { dbm(mapping.GetMapping(token)) = 0; };
 		virtual bool IsEmpty() const { return dbm.isEmpty(); };
 		virtual void Delay()
 		{
 			dbm.up();
-			for(unsigned int i = 0; i < NumberOfTokens(); i++)
-			{
-				const TAPN::TimeInvariant& invariant = tapn->GetPlace(GetTokenPlacement(i)).GetInvariant();
-				Constrain(i, invariant);
-				assert(!IsEmpty()); // this should not be possible
-			}
+			ConstrainInvariants();
+			assert(!IsEmpty()); // this should not be possible
 		};
+		virtual void ConstrainInvariants();
 		virtual void Constrain(int token, const TAPN::TimeInterval& interval)
 		{
 			int clock = mapping.GetMapping(token);
@@ -52,6 +61,8 @@ namespace VerifyTAPN {
 			}
 		};
 
+		virtual void Constrain(const GuardList& guards);
+
 		virtual bool PotentiallySatisfies(int token, const TAPN::TimeInterval& interval) const
 		{
 			int clock = mapping.GetMapping(token);
@@ -61,6 +72,8 @@ namespace VerifyTAPN {
 			return !inappropriateAge;
 		};
 
+		virtual bool PotentiallySatisfies(int token, const TAPN::TimeInterval& interval, int other, const TAPN::TimeInterval& otherInterval) const;
+
 		virtual relation Relation(const StoredMarking& other) const
 		{
 			relation_t relation = dbm.relation(static_cast<const DBMMarking&>(other).dbm);
@@ -69,6 +82,8 @@ namespace VerifyTAPN {
 
 		virtual void Extrapolate(const int* maxConstants) { dbm.diagonalExtrapolateMaxBounds(maxConstants); };
 		virtual unsigned int GetClockIndex(unsigned int token) const { return mapping.GetMapping(token); };
+		virtual bool AreTokensEquivalent(int token, int other) const;
+		virtual bool IsCoveredBy(const std::vector<SymbolicMarking*>& zones) const;
 
 		virtual void AddTokens(const std::list<int>& placeIndices);
 		virtual void RemoveTokens(const std::set<int>& tokenIndices);
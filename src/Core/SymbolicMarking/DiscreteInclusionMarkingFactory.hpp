@@ -101,7 +101,7 @@ public:
 
 	virtual void Release(SymbolicMarking* marking)
 	{
-		if(marking != 0) delete marking;
+		if(marking != 0) Recycle(marking);
 	};
 
 	virtual void Release(StoredMarking* marking)
@@ -109,6 +109,26 @@ public:
 		if(marking != 0) delete marking;
 	};
 
+	virtual void Write(BinaryWriter& out, const StoredMarking& marking) const
+	{
+		const DiscretePartInclusionMarking& dpiMarking = static_cast<const DiscretePartInclusionMarking&>(marking);
+		out.Write(dpiMarking.id);
+		out.WriteVector(dpiMarking.eq);
+		out.WriteVector(dpiMarking.inc);
+		WriteMapping(out, dpiMarking.mapping);
+		WriteDBM(out, dpiMarking.dbm);
+	};
+
+	virtual StoredMarking* Read(BinaryReader& in) const
+	{
+		id_type id = in.Read<id_type>();
+		std::vector<int> eq, inc;
+		in.ReadVector(eq);
+		in.ReadVector(inc);
+		TokenMapping mapping = ReadMapping(in);
+		return new DiscretePartInclusionMarking(id, eq, inc, mapping, ReadDBM(in));
+	};
+
 private:
 	bool BelongsToINC(int token, const DBMMarking& marking) const
 	{
@@ -10,21 +10,17 @@ namespace VerifyTAPN {
 	{
 		assert(tokenIndex >= 0 && tokenIndex < placement.size());
 
+		counts[placement[tokenIndex]]--;
 		placement[tokenIndex] = newPlaceIndex;
+		Count(newPlaceIndex);
 	}
 
-	int DiscretePart::NumberOfTokensInPlace(int placeIndex) const
+	void DiscretePart::InitCounts()
 	{
-		int i = 0;
 		for(std::vector<int>::const_iterator iter = placement.begin(); iter != placement.end(); ++iter)
 		{
-			if((*iter) == placeIndex)
-			{
-				i++;
-			}
+			Count(*iter);
 		}
-
-		return i;
 	}
 
 	void DiscretePart::Swap(int tokenI, int tokenJ)
@@ -3,50 +3,64 @@
 
 #include <vector>
 #include "boost/functional/hash.hpp"
-#include "../../HashFunctions/MurmurHash2Neutral.hpp"
+#include "../../HashFunctions/PlacementHash.hpp"
 #include <iostream>
+#include "assert.h"
 
 namespace VerifyTAPN {
 	struct hash;
 	struct eqdp;
 
+	// The placement of the tokens, plus the number of tokens in each place. The
+	// counts are kept up to date by the modifiers, so counting the tokens in a place
+	// does not scan the placement.
 	class DiscretePart {
 		friend struct VerifyTAPN::hash;
 		friend struct VerifyTAPN::eqdp;
 	public: // construction
-		DiscretePart() : placement() { };
-		explicit DiscretePart(const std::vector<int>& placement) : placement(placement) { };
-		DiscretePart(const DiscretePart& dp) : placement(dp.placement) { };
+		DiscretePart() : placement(), counts() { };
+		explicit DiscretePart(const std::vector<int>& placement) : placement(placement), counts() { InitCounts(); };
+		DiscretePart(const DiscretePart& dp) : placement(dp.placement), counts(dp.counts) { };
 		DiscretePart& operator=(const DiscretePart& dp)
 		{
 			placement = dp.placement;
+			counts = dp.counts;
 			return *this;
 		}
 		virtual ~DiscretePart() { };
 
 	public: // inspectors
 		inline int GetTokenPlacement(unsigned int tokenIndex) const { return placement[tokenIndex]; }
-		int NumberOfTokensInPlace(int placeIndex) const;
+		inline int NumberOfTokensInPlace(int placeIndex) const { return static_cast<unsigned int>(placeIndex) < counts.size() ? counts[placeIndex] : 0; }
 		const std::vector<int>& GetTokenPlacementVector() const { return placement; }
 		inline const unsigned int size() const { return placement.size(); }
 
 
 	public: // modifiers
 		void MoveToken(unsigned int tokenIndex, int newPlaceIndex);
-		void RemoveToken(int index) { placement.erase(placement.begin() + index); }
-		void AddTokenInPlace(int placeIndex) { placement.push_back(placeIndex); }
+		void RemoveToken(int index) { counts[placement[index]]--; placement.erase(placement.begin() + index); }
+		void AddTokenInPlace(int placeIndex) { placement.push_back(placeIndex); Count(placeIndex); }
 		void Swap(int tokenI, int tokenJ);
 
+	private:
+		void InitCounts();
+		inline void Count(int placeIndex)
+		{
+			assert(placeIndex >= 0);
+			if(static_cast<unsigned int>(placeIndex) >= counts.size()) counts.resize(placeIndex + 1, 0);
+			counts[placeIndex]++;
+		}
+
 	private: // data
 		std::vector<int> placement;
+		std::vector<int> counts; // indexed by place, only as long as the highest place that has held a token
 	};
 
 	struct hash : public std::unary_function<const VerifyTAPN::DiscretePart, size_t>
 	{
 		size_t operator()(const VerifyTAPN::DiscretePart& dp) const
 		{
-			size_t hash = boost::hash_range(dp.placement.begin(), dp.placement.end());
-			return hash;
+			return HashPlacement(dp.placement);
 		}
 	};
 
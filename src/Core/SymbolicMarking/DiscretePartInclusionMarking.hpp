@@ -7,6 +7,7 @@
 #include <algorithm>
 #include "TokenMapping.hpp"
 #include "../../typedefs.hpp"
+#include "../../HashFunctions/PlacementHash.hpp"
 #include <dbm/fed.h>
 #include <iosfwd>
 
@@ -15,11 +16,22 @@ namespace VerifyTAPN {
 class DiscretePartInclusionMarking : public StoredMarking {
 	friend class DiscreteInclusionMarkingFactory;
 public:
-	DiscretePartInclusionMarking(id_type id, const std::vector<int>& eq, const std::vector<int>& inc, const TokenMapping& mapping, const dbm::dbm_t& dbm) : eq(eq), inc(inc), mapping(mapping), dbm(dbm), id(id) { };
-	DiscretePartInclusionMarking(const DiscretePartInclusionMarking& dm) : eq(dm.eq), inc(dm.inc), mapping(dm.mapping), dbm(dm.dbm), id(dm.id) { };
+	DiscretePartInclusionMarking(id_type id, const std::vector<int>& eq, const std::vector<int>& inc, const TokenMapping& mapping, const dbm::dbm_t& dbm) : eq(eq), inc(inc), mapping(mapping), dbm(dbm), id(id), nIncTokens(SumIncTokens()) { };
+	DiscretePartInclusionMarking(const DiscretePartInclusionMarking& dm) : eq(dm.eq), inc(dm.inc), mapping(dm.mapping), dbm(dm.dbm), id(dm.id), nIncTokens(dm.nIncTokens) { };
 	virtual ~DiscretePartInclusionMarking() { };
 
-	virtual size_t HashKey() const { return boost::hash_range(eq.begin(), eq.end()); };
+	virtual size_t HashKey() const { return HashPlacement(eq); };
+	virtual size_t ExactHashKey() const
+	{
+		size_t seed = HashPlacement(inc, HashKey());
+		boost::hash_combine(seed, dbm.hash());
+		return seed;
+	};
+	virtual bool Equals(const StoredMarking& stored) const
+	{
+		const DiscretePartInclusionMarking& other = static_cast<const DiscretePartInclusionMarking&>(stored);
+		return eq == other.eq && inc == other.inc && mapping == other.mapping && dbm == other.dbm;
+	};
 
 	virtual relation Relation(const StoredMarking& stored) const
 	{
@@ -74,22 +86,29 @@ public:
 
 	unsigned int GetClockIndex(unsigned int index) { return mapping.GetMapping(index); };
 
-	unsigned int size() const
-	{
-		int size = eq.size();
-		for(unsigned int i = 0; i < inc.size(); i++)
-		{
-			size += inc[i];
-		}
-
-		return size;
-	};
+	unsigned int size() const { return eq.size() + nIncTokens; };
 
 	virtual unsigned int UniqueId() const { return id; };
 	virtual void Print(std::ostream& out) const;
 
+	virtual unsigned int NumberOfTokensInPlace(int placeIndex) const
+	{
+		return std::count(eq.begin(), eq.end(), placeIndex) + inc[placeIndex];
+	};
+
 	virtual const std::vector<int>& inclusionTokens() const { return inc; };
+	inline unsigned int NumberOfInclusionTokens() const { return nIncTokens; };
 private:
+	unsigned int SumIncTokens() const
+	{
+		unsigned int sum = 0;
+		for(unsigned int i = 0; i < inc.size(); i++)
+		{
+			sum += inc[i];
+		}
+		return sum;
+	};
+
 	relation ConvertToRelation(relation_t relation) const
 	{
 		switch(relation)
@@ -107,6 +126,7 @@ private:
 	TokenMapping mapping;
 	dbm::dbm_t dbm;
 	id_type id;
+	unsigned int nIncTokens; // cached sum of inc, used for the size and by the cover-most search
 };
 
 }
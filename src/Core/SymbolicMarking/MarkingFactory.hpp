@@ -6,6 +6,8 @@
 namespace VerifyTAPN {
 	class SymbolicMarking;
 	class StoredMarking;
+	class BinaryWriter;
+	class BinaryReader;
 
 	class MarkingFactory {
 	public:
@@ -19,6 +21,15 @@ namespace VerifyTAPN {
 
 		virtual void Release(SymbolicMarking* marking) = 0;
 		virtual void Release(StoredMarking* marking) = 0;
+		// Gives back a marking obtained from Clone which was never handed on, e.g. a
+		// successor candidate with an empty zone, so that Clone can reuse it.
+		virtual void Recycle(SymbolicMarking* marking) const = 0;
+
+		// checkpointing
+		virtual void Write(BinaryWriter& out, const StoredMarking& marking) const = 0;
+		virtual StoredMarking* Read(BinaryReader& in) const = 0;
+		virtual void WriteState(BinaryWriter& out) const = 0;
+		virtual void ReadState(BinaryReader& in) = 0;
 	};
 
 }
@@ -15,6 +15,9 @@ namespace VerifyTAPN
 
 		virtual relation Relation(const StoredMarking& other) const = 0;
 		virtual size_t HashKey() const = 0;
+		virtual size_t ExactHashKey() const = 0; // hash of both the discrete part and the zone
+		virtual bool Equals(const StoredMarking& other) const = 0;
+		virtual unsigned int NumberOfTokensInPlace(int placeIndex) const = 0;
 
 		virtual void Print(std::ostream& out) const = 0;
 	};
@@ -17,8 +17,14 @@ namespace VerifyTAPN {
 		virtual void Delay() = 0; // Maybe call this up to match terminology of Down?
 		//	virtual void Down() = 0;
 		virtual bool IsEmpty() const = 0;
+		virtual void ConstrainInvariants() = 0; // the invariants of the places of all tokens, closing the zone only once
 		virtual void Extrapolate(const int* maxConstants) = 0;
 		virtual unsigned int GetClockIndex(unsigned int token) const = 0;
+		// True if swapping the two tokens yields the same marking, i.e. firing with either gives symmetric successors
+		virtual bool AreTokensEquivalent(int token, int other) const = 0;
+		// True if every clock valuation of the marking lies in one of the zones, which
+		// must be constrained clones of the marking
+		virtual bool IsCoveredBy(const std::vector<SymbolicMarking*>& zones) const = 0;
 	};
 }
 #endif /* SYMBOLICMARKING_HPP_ */
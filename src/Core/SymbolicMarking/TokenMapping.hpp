@@ -22,6 +22,7 @@ namespace VerifyTAPN {
 			};
 
 			const unsigned int size() const { return mapping.size(); };
+			bool operator==(const TokenMapping& other) const { return mapping == other.mapping; };
 
 		public: // modifiers
 			void SetMapping(unsigned int index, unsigned int dbmIndex)
@@ -4,6 +4,7 @@
 #include "MarkingFactory.hpp"
 #include "DBMMarking.hpp"
 #include "dbm/print.h"
+#include "../BinaryStream.hpp"
 
 namespace VerifyTAPN {
 
@@ -11,11 +12,15 @@ namespace VerifyTAPN {
 	protected:
 		static id_type nextId;
 	public:
-		UppaalDBMMarkingFactory(const boost::shared_ptr<TAPN::TimedArcPetriNet>& tapn)
+		UppaalDBMMarkingFactory(const boost::shared_ptr<TAPN::TimedArcPetriNet>& tapn) : pool()
 		{
 			DBMMarking::tapn = tapn;
 		};
-		virtual ~UppaalDBMMarkingFactory() {};
+		virtual ~UppaalDBMMarkingFactory()
+		{
+			for(std::vector<DBMMarking*>::iterator it = pool.begin(); it != pool.end(); ++it)
+				delete *it;
+		};
 
 		virtual SymbolicMarking* InitialMarking(const std::vector<int>& tokenPlacement) const
 		{
@@ -26,13 +31,30 @@ namespace VerifyTAPN {
 			return marking;
 		};
 
+		// Recycled markings are overwritten in place, which reuses their placement and mapping buffers.
 		virtual SymbolicMarking* Clone(const SymbolicMarking& marking) const
 		{
-			DBMMarking* clone = new DBMMarking(static_cast<const DBMMarking&>(marking));
+			DBMMarking* clone;
+			if(pool.empty())
+			{
+				clone = new DBMMarking(static_cast<const DBMMarking&>(marking));
+			}
+			else
+			{
+				clone = pool.back();
+				pool.pop_back();
+				*clone = static_cast<const DBMMarking&>(marking);
+			}
 			clone->id = nextId++;
 			return clone;
 		};
 
+		virtual void Recycle(SymbolicMarking* marking) const
+		{
+			if(pool.size() < MAX_POOL_SIZE) pool.push_back(static_cast<DBMMarking*>(marking));
+			else delete marking;
+		};
+
 		virtual StoredMarking* Convert(SymbolicMarking* marking) const { return static_cast<DBMMarking*>(marking); };
 		virtual SymbolicMarking* Convert(StoredMarking* marking) const { return static_cast<DBMMarking*>(marking); };
 
@@ -43,7 +65,66 @@ namespace VerifyTAPN {
 
 		virtual void Release(StoredMarking* marking)
 		{
-			delete marking;
+			Recycle(static_cast<DBMMarking*>(marking));
+		};
+
+		virtual void Write(BinaryWriter& out, const StoredMarking& marking) const
+		{
+			const DBMMarking& dbmMarking = static_cast<const DBMMarking&>(marking);
+			out.Write(dbmMarking.id);
+			out.WriteVector(dbmMarking.dp.GetTokenPlacementVector());
+			WriteMapping(out, dbmMarking.mapping);
+			WriteDBM(out, dbmMarking.dbm);
+		};
+
+		virtual StoredMarking* Read(BinaryReader& in) const
+		{
+			id_type id = in.Read<id_type>();
+			std::vector<int> placement;
+			in.ReadVector(placement);
+			TokenMapping mapping = ReadMapping(in);
+			DBMMarking* marking = new DBMMarking(DiscretePart(placement), mapping, ReadDBM(in));
+			marking->id = id;
+			return marking;
+		};
+
+		virtual void WriteState(BinaryWriter& out) const { out.Write(nextId); };
+		virtual void ReadState(BinaryReader& in) { nextId = in.Read<id_type>(); };
+
+	protected:
+		static const unsigned int MAX_POOL_SIZE = 256;
+		mutable std::vector<DBMMarking*> pool;
+
+	protected:
+		static void WriteMapping(BinaryWriter& out, const TokenMapping& mapping)
+		{
+			out.Write<unsigned int>(mapping.size());
+			for(unsigned int i = 0; i < mapping.size(); i++)
+			{
+				out.Write<unsigned int>(mapping.GetMapping(i));
+			}
+		};
+
+		static TokenMapping ReadMapping(BinaryReader& in)
+		{
+			std::vector<unsigned int> mapping;
+			in.ReadVector(mapping);
+			return TokenMapping(mapping);
+		};
+
+		static void WriteDBM(BinaryWriter& out, const dbm::dbm_t& dbm)
+		{
+			unsigned int dim = dbm.getDimension();
+			out.Write(dim);
+			out.WriteArray(dbm(), dim*dim*sizeof(raw_t));
+		};
+
+		static dbm::dbm_t ReadDBM(BinaryReader& in)
+		{
+			unsigned int dim = in.Read<unsigned int>();
+			std::vector<raw_t> raw(dim*dim);
+			in.ReadArray(&raw[0], dim*dim*sizeof(raw_t));
+			return dbm::dbm_t(&raw[0], dim);
 		};
 	};
 
@@ -2,6 +2,8 @@
 
 #include "TimeInterval.hpp"
 #include <limits>
+#include <map>
+#include <algorithm>
 
 namespace VerifyTAPN {
 	namespace TAPN {
@@ -15,14 +17,6 @@ namespace VerifyTAPN {
 			for(unsigned int i = 0; i < transitions.size(); i++){
 				transitions[i]->SetIndex(i);
 			}
-//			placeIndices.set_empty_key(""); // assume place always have a name
-//			IndexMap::value_type bottom(TimedPlace::Bottom().GetName(), TimedPlace::BottomIndex());
-//			placeIndices.insert(bottom);
-//			for(unsigned int i = 0; i < places.size(); i++){
-//				IndexMap::value_type pair(places[i]->GetName(), i);
-//				placeIndices.insert(pair);
-//			}
-
 			for(TimedInputArc::Vector::const_iterator iter = inputArcs.begin(); iter != inputArcs.end(); ++iter)
 			{
 				const boost::shared_ptr<TimedInputArc>& arc = *iter;
@@ -130,9 +124,36 @@ namespace VerifyTAPN {
 				(*iter)->SetMaxConstant(maxConstant);
 			}
 
-			for(TransportArc::Vector::const_iterator iter = transportArcs.begin(); iter != transportArcs.end(); iter++)
+			// A transported token keeps its age, so the source place must distinguish ages up
+			// to the constants of the transport guard and of the destination place.
+			bool changed = true;
+			while(changed)
 			{
-				(*iter)->Source().SetMaxConstant(this->maxConstant);
+				changed = false;
+				for(TransportArc::Vector::const_iterator iter = transportArcs.begin(); iter != transportArcs.end(); iter++)
+				{
+					const TAPN::TimeInterval& interval = (*iter)->Interval();
+					int bound = interval.GetUpperBound() == std::numeric_limits<int>().max() ? interval.GetLowerBound() : interval.GetUpperBound();
+					bound = std::max(bound, (*iter)->Destination().GetMaxConstant());
+					if(bound > (*iter)->Source().GetMaxConstant())
+					{
+						(*iter)->Source().SetMaxConstant(bound);
+						changed = true;
+					}
+				}
+			}
+		}
+
+		// Places outside the cone of influence of the visible places can never affect
+		// them, so the ages of their tokens do not matter and they are treated like
+		// untimed places.
+		void TimedArcPetriNet::MarkTimeIrrelevantPlaces(const std::vector<int>& visiblePlaces)
+		{
+			std::vector<bool> relevant, kept;
+			ConeOfInfluence(visiblePlaces, relevant, kept);
+			for(unsigned int p = 0; p < places.size(); p++)
+			{
+				if(!relevant[p]) places[p]->MarkPlaceAsUntimed();
 			}
 		}
 
@@ -159,19 +180,143 @@ namespace VerifyTAPN {
 			}
 		}
 
-		int TimedArcPetriNet::GetPlaceIndex(const std::string& placeName) const
+		// Computes the cone of influence of the visible places, i.e. the transitions that can
+		// change the marking of a visible place, directly or by enabling or disabling such a
+		// transition (kept), and the places they read (relevant). Places with an invariant
+		// are always relevant, since their tokens restrict delays. Transitions that change
+		// the number of tokens are always kept, since the k-bound depends on them.
+		void TimedArcPetriNet::ConeOfInfluence(const std::vector<int>& visiblePlaces, std::vector<bool>& relevant, std::vector<bool>& kept) const
 		{
-				int idx = TimedPlace::BottomIndex();
-				for(unsigned int i = 0; i < places.size(); ++i)
+			std::map<const TimedPlace*, int> placeIndices;
+			for(unsigned int i = 0; i < places.size(); i++) placeIndices[places[i].get()] = i;
+			std::map<const TimedTransition*, int> transitionIndices;
+			for(unsigned int i = 0; i < transitions.size(); i++) transitionIndices[transitions[i].get()] = i;
+
+			std::vector< std::vector<int> > changedBy(places.size()); // transitions consuming from or producing to p
+			std::vector< std::vector<int> > dependsOn(transitions.size()); // places whose marking can enable or disable t
+			std::vector<int> tokenChange(transitions.size(), 0);
+			for(TimedInputArc::Vector::const_iterator iter = inputArcs.begin(); iter != inputArcs.end(); ++iter)
+			{
+				int p = placeIndices[&(*iter)->InputPlace()], t = transitionIndices[&(*iter)->OutputTransition()];
+				changedBy[p].push_back(t);
+				dependsOn[t].push_back(p);
+				tokenChange[t]--;
+			}
+			for(TransportArc::Vector::const_iterator iter = transportArcs.begin(); iter != transportArcs.end(); ++iter)
+			{
+				int t = transitionIndices[&(*iter)->Transition()];
+				int source = placeIndices[&(*iter)->Source()];
+				changedBy[source].push_back(t);
+				changedBy[placeIndices[&(*iter)->Destination()]].push_back(t);
+				dependsOn[t].push_back(source);
+			}
+			for(OutputArc::Vector::const_iterator iter = outputArcs.begin(); iter != outputArcs.end(); ++iter)
+			{
+				int t = transitionIndices[&(*iter)->InputTransition()];
+				changedBy[placeIndices[&(*iter)->OutputPlace()]].push_back(t);
+				tokenChange[t]++;
+			}
+			for(InhibitorArc::Vector::const_iterator iter = inhibitorArcs.begin(); iter != inhibitorArcs.end(); ++iter)
+			{
+				dependsOn[transitionIndices[&(*iter)->OutputTransition()]].push_back(placeIndices[&(*iter)->InputPlace()]);
+			}
+
+			relevant.assign(places.size(), false);
+			kept.assign(transitions.size(), false);
+			std::vector<int> stack;
+			for(unsigned int p = 0; p < places.size(); p++)
+			{
+				if(places[p]->GetInvariant() != TimeInvariant::LS_INF) stack.push_back(p);
+			}
+			for(std::vector<int>::const_iterator iter = visiblePlaces.begin(); iter != visiblePlaces.end(); ++iter)
+			{
+				if(*iter >= 0) stack.push_back(*iter);
+			}
+			for(unsigned int t = 0; t < transitions.size(); t++)
+			{
+				if(tokenChange[t] == 0) continue;
+				kept[t] = true;
+				stack.insert(stack.end(), dependsOn[t].begin(), dependsOn[t].end());
+			}
+			while(!stack.empty())
+			{
+				int p = stack.back();
+				stack.pop_back();
+				if(relevant[p]) continue;
+				relevant[p] = true;
+
+				for(std::vector<int>::const_iterator t = changedBy[p].begin(); t != changedBy[p].end(); ++t)
 				{
-					if(places[i]->GetName() == placeName)
-					{
-						idx = i;
-						break;
-					}
+					if(kept[*t]) continue;
+					kept[*t] = true;
+					stack.insert(stack.end(), dependsOn[*t].begin(), dependsOn[*t].end());
 				}
+			}
+		}
+
+		// Returns the net restricted to the cone of influence of the visible places.
+		// relevant[p] tells whether place p is in the cone. All places are kept, so place
+		// indices stay the same, and the remaining transitions keep all their arcs. The
+		// removed transitions neither change the number of tokens nor touch a relevant
+		// place, so the k-bound cuts the same firings and the number of tokens in a
+		// marking is unchanged. Irrelevant places are only produced into, so their ages
+		// are abstracted away as untimed places. Must be called before Initialize, and
+		// the sliced net must be initialized instead of this one.
+		boost::shared_ptr<TimedArcPetriNet> TimedArcPetriNet::Slice(const std::vector<int>& visiblePlaces, std::vector<bool>& relevant) const
+		{
+			std::vector<bool> kept;
+			ConeOfInfluence(visiblePlaces, relevant, kept);
+
+			std::map<const TimedTransition*, int> transitionIndices;
+			for(unsigned int i = 0; i < transitions.size(); i++) transitionIndices[transitions[i].get()] = i;
+
+			TimedTransition::Vector slicedTransitions;
+			for(unsigned int t = 0; t < transitions.size(); t++)
+			{
+				if(kept[t]) slicedTransitions.push_back(transitions[t]);
+			}
+
+			TimedInputArc::Vector slicedInputArcs;
+			for(TimedInputArc::Vector::const_iterator iter = inputArcs.begin(); iter != inputArcs.end(); ++iter)
+			{
+				if(kept[transitionIndices[&(*iter)->OutputTransition()]]) slicedInputArcs.push_back(*iter);
+			}
+
+			TransportArc::Vector slicedTransportArcs;
+			for(TransportArc::Vector::const_iterator iter = transportArcs.begin(); iter != transportArcs.end(); ++iter)
+			{
+				if(kept[transitionIndices[&(*iter)->Transition()]]) slicedTransportArcs.push_back(*iter);
+			}
 
-				return idx;
+			OutputArc::Vector slicedOutputArcs;
+			for(OutputArc::Vector::const_iterator iter = outputArcs.begin(); iter != outputArcs.end(); ++iter)
+			{
+				if(kept[transitionIndices[&(*iter)->InputTransition()]]) slicedOutputArcs.push_back(*iter);
+			}
+
+			InhibitorArc::Vector slicedInhibitorArcs;
+			for(InhibitorArc::Vector::const_iterator iter = inhibitorArcs.begin(); iter != inhibitorArcs.end(); ++iter)
+			{
+				if(kept[transitionIndices[&(*iter)->OutputTransition()]]) slicedInhibitorArcs.push_back(*iter);
+			}
+
+			return boost::make_shared<TimedArcPetriNet>(places, slicedTransitions, slicedInputArcs, slicedOutputArcs, slicedTransportArcs, slicedInhibitorArcs);
+		}
+
+		// The markings and the queries are parsed before Initialize, so the index is
+		// built when the net is constructed. The first place of a name wins, as with
+		// the linear search this replaces.
+		void TimedArcPetriNet::IndexPlaces()
+		{
+			for(unsigned int i = 0; i < places.size(); i++){
+				placeIndices.insert(IndexMap::value_type(places[i]->GetName(), i));
+			}
+		}
+
+		int TimedArcPetriNet::GetPlaceIndex(const std::string& placeName) const
+		{
+			IndexMap::const_iterator iter = placeIndices.find(placeName);
+			return iter == placeIndices.end() ? TimedPlace::BottomIndex() : iter->second;
 		}
 
 		void TimedArcPetriNet::Print(std::ostream & out) const
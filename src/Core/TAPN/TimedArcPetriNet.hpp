@@ -21,6 +21,7 @@ namespace VerifyTAPN {
 		{
 		public: // typedefs
 			typedef google::sparse_hash_map<TimedTransition, VerifyTAPN::Pairing, boost::hash<TAPN::TimedTransition> > HashMap;
+			typedef google::sparse_hash_map<std::string, int, boost::hash<std::string> > IndexMap;
 		public:// construction
 			TimedArcPetriNet(const TimedPlace::Vector& places,
 				const TimedTransition::Vector& transitions,
@@ -28,7 +29,7 @@ namespace VerifyTAPN {
 				const OutputArc::Vector& outputArcs,
 				const TransportArc::Vector& transportArcs,
 				const InhibitorArc::Vector& inhibitorArcs)
-				: places(places), transitions(transitions), inputArcs(inputArcs), outputArcs(outputArcs), transportArcs(transportArcs), inhibitorArcs(inhibitorArcs), maxConstant(0) { };
+				: places(places), transitions(transitions), inputArcs(inputArcs), outputArcs(outputArcs), transportArcs(transportArcs), inhibitorArcs(inhibitorArcs), placeIndices(), maxConstant(0) { IndexPlaces(); };
 			virtual ~TimedArcPetriNet() { /* empty */ }
 
 		public: // inspectors
@@ -49,11 +50,17 @@ namespace VerifyTAPN {
 			const Pairing& GetPairing(const TimedTransition& t) const { return pairings.find(t)->second; }
 			inline int MaxConstant() const { return maxConstant; };
 			inline const bool IsPlaceUntimed(int index) const { return places[index]->IsUntimed(); }
+			boost::shared_ptr<TimedArcPetriNet> Slice(const std::vector<int>& visiblePlaces, std::vector<bool>& relevant) const;
 		public: // modifiers
 			void Initialize(bool useUntimedPlaces);
+			void MarkTimeIrrelevantPlaces(const std::vector<int>& visiblePlaces);
 
 
+		private:
+			void ConeOfInfluence(const std::vector<int>& visiblePlaces, std::vector<bool>& relevant, std::vector<bool>& kept) const;
+
 		private: // modifiers
+			void IndexPlaces();
 			void MakeTAPNConservative();
 			void GeneratePairings();
 			void UpdateMaxConstant(const TimeInterval& interval);
@@ -69,6 +76,7 @@ namespace VerifyTAPN {
 			const TransportArc::Vector transportArcs;
 			const InhibitorArc::Vector inhibitorArcs;
 			mutable HashMap pairings;
+			IndexMap placeIndices; // by name
 			int maxConstant;
 		};
 
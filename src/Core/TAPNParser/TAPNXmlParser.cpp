@@ -1,7 +1,5 @@
 #include "TAPNXmlParser.hpp"
 #include <string>
-#include <algorithm>
-#include "boost/bind.hpp"
 #include "boost/algorithm/string.hpp"
 #include "boost/lexical_cast.hpp"
 #include "util.hpp"
@@ -100,8 +98,15 @@ namespace VerifyTAPN {
 		return boost::make_shared<TimedTransition>(name, id);
 	}
 
-	TAPNXmlParser::ArcCollections TAPNXmlParser::ParseArcs(const xml_node<>& root, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const
+	TAPNXmlParser::ArcCollections TAPNXmlParser::ParseArcs(const xml_node<>& root, const TimedPlace::Vector& placeVector, const TimedTransition::Vector& transitionVector) const
 	{
+		PlaceMap places(placeVector.size());
+		for(TimedPlace::Vector::const_iterator iter = placeVector.begin(); iter != placeVector.end(); ++iter)
+			places.insert(PlaceMap::value_type((*iter)->GetId(), *iter));
+
+		TransitionMap transitions(transitionVector.size());
+		for(TimedTransition::Vector::const_iterator iter = transitionVector.begin(); iter != transitionVector.end(); ++iter)
+			transitions.insert(TransitionMap::value_type((*iter)->GetId(), *iter));
 
 		TimedInputArc::Vector inputArcs = ParseInputArcs(root, places, transitions);
 		TransportArc::Vector transportArcs = ParseTransportArcs(root, places, transitions);
@@ -111,7 +116,7 @@ namespace VerifyTAPN {
 		return ArcCollections(inputArcs, outputArcs, transportArcs, inhibitorArcs);
 	}
 
-	TransportArc::Vector TAPNXmlParser::ParseTransportArcs(const rapidxml::xml_node<>& root, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const
+	TransportArc::Vector TAPNXmlParser::ParseTransportArcs(const rapidxml::xml_node<>& root, const PlaceMap& places, const TransitionMap& transitions) const
 	{
 		TransportArc::Vector transportArcs;
 		xml_node<>* arcNode = root.first_node("transportArc");
@@ -122,7 +127,7 @@ namespace VerifyTAPN {
 		return transportArcs;
 	}
 
-	InhibitorArc::Vector TAPNXmlParser::ParseInhibitorArcs(const rapidxml::xml_node<>& root, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const
+	InhibitorArc::Vector TAPNXmlParser::ParseInhibitorArcs(const rapidxml::xml_node<>& root, const PlaceMap& places, const TransitionMap& transitions) const
 	{
 		InhibitorArc::Vector inhibitorArcs;
 		xml_node<>* arcNode = root.first_node("inhibitorArc");
@@ -133,7 +138,7 @@ namespace VerifyTAPN {
 		return inhibitorArcs;
 	}
 
-	TimedInputArc::Vector TAPNXmlParser::ParseInputArcs(const xml_node<>& root, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const
+	TimedInputArc::Vector TAPNXmlParser::ParseInputArcs(const xml_node<>& root, const PlaceMap& places, const TransitionMap& transitions) const
 	{
 		TimedInputArc::Vector inputArcs;
 		xml_node<>* arcNode = root.first_node("inputArc");
@@ -145,7 +150,7 @@ namespace VerifyTAPN {
 		return inputArcs;
 	}
 
-	OutputArc::Vector TAPNXmlParser::ParseOutputArcs(const xml_node<>& root, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const
+	OutputArc::Vector TAPNXmlParser::ParseOutputArcs(const xml_node<>& root, const PlaceMap& places, const TransitionMap& transitions) const
 	{
 		OutputArc::Vector outputArcs;
 		xml_node<>* arcNode = root.first_node("outputArc");
@@ -157,52 +162,66 @@ namespace VerifyTAPN {
 		return outputArcs;
 	}
 
-	boost::shared_ptr<TimedInputArc> TAPNXmlParser::ParseInputArc(const rapidxml::xml_node<>& arcNode, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const
+	boost::shared_ptr<TimedInputArc> TAPNXmlParser::ParseInputArc(const rapidxml::xml_node<>& arcNode, const PlaceMap& places, const TransitionMap& transitions) const
 	{
 		std::string source = arcNode.first_attribute("source")->value();
 		std::string target = arcNode.first_attribute("target")->value();
 		std::string interval = arcNode.first_attribute("inscription")->value();
 
-		TimedPlace::Vector::const_iterator place = find_if(places.begin(), places.end(), boost::bind(boost::mem_fn(&TimedPlace::GetId), _1) == source);
-		TimedTransition::Vector::const_iterator transition = find_if(transitions.begin(), transitions.end(), boost::bind(boost::mem_fn(&TimedTransition::GetId), _1) == target);
+		const boost::shared_ptr<TimedPlace>& place = FindPlace(places, source);
+		const boost::shared_ptr<TimedTransition>& transition = FindTransition(transitions, target);
 
-		return boost::make_shared<TimedInputArc>(*place, *transition, TimeInterval::CreateFor(interval));
+		return boost::make_shared<TimedInputArc>(place, transition, TimeInterval::CreateFor(interval));
 	}
 
-	boost::shared_ptr<TransportArc> TAPNXmlParser::ParseTransportArc(const rapidxml::xml_node<>& arcNode, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const
+	boost::shared_ptr<TransportArc> TAPNXmlParser::ParseTransportArc(const rapidxml::xml_node<>& arcNode, const PlaceMap& places, const TransitionMap& transitions) const
 	{
 		std::string sourceName = arcNode.first_attribute("source")->value();
 		std::string transitionName = arcNode.first_attribute("transition")->value();
 		std::string targetName = arcNode.first_attribute("target")->value();
 		std::string interval = arcNode.first_attribute("inscription")->value();
 
-		TimedPlace::Vector::const_iterator source = find_if(places.begin(), places.end(), boost::bind(boost::mem_fn(&TimedPlace::GetId), _1) == sourceName);
-		TimedTransition::Vector::const_iterator transition = find_if(transitions.begin(), transitions.end(), boost::bind(boost::mem_fn(&TimedTransition::GetId), _1) == transitionName);
-		TimedPlace::Vector::const_iterator target = find_if(places.begin(), places.end(), boost::bind(boost::mem_fn(&TimedPlace::GetId), _1) == targetName);
-		return boost::make_shared<TransportArc>(*source, *transition, *target, TimeInterval::CreateFor(interval));
+		const boost::shared_ptr<TimedPlace>& source = FindPlace(places, sourceName);
+		const boost::shared_ptr<TimedTransition>& transition = FindTransition(transitions, transitionName);
+		const boost::shared_ptr<TimedPlace>& target = FindPlace(places, targetName);
+		return boost::make_shared<TransportArc>(source, transition, target, TimeInterval::CreateFor(interval));
 	}
 
-	boost::shared_ptr<InhibitorArc> TAPNXmlParser::ParseInhibitorArc(const rapidxml::xml_node<>& arcNode, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const
+	boost::shared_ptr<InhibitorArc> TAPNXmlParser::ParseInhibitorArc(const rapidxml::xml_node<>& arcNode, const PlaceMap& places, const TransitionMap& transitions) const
 	{
 		std::string source = arcNode.first_attribute("source")->value();
 		std::string target = arcNode.first_attribute("target")->value();
 
-		TimedPlace::Vector::const_iterator place = find_if(places.begin(), places.end(), boost::bind(boost::mem_fn(&TimedPlace::GetId), _1) == source);
-		TimedTransition::Vector::const_iterator transition = find_if(transitions.begin(), transitions.end(), boost::bind(boost::mem_fn(&TimedTransition::GetId), _1) == target);
+		const boost::shared_ptr<TimedPlace>& place = FindPlace(places, source);
+		const boost::shared_ptr<TimedTransition>& transition = FindTransition(transitions, target);
 
-		return boost::make_shared<InhibitorArc>(*place, *transition);
+		return boost::make_shared<InhibitorArc>(place, transition);
 	}
 
-	boost::shared_ptr<OutputArc> TAPNXmlParser::ParseOutputArc(const rapidxml::xml_node<>& arcNode, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const
+	boost::shared_ptr<OutputArc> TAPNXmlParser::ParseOutputArc(const rapidxml::xml_node<>& arcNode, const PlaceMap& places, const TransitionMap& transitions) const
 	{
 		std::string source = arcNode.first_attribute("source")->value();
 		std::string target = arcNode.first_attribute("target")->value();
 
-		TimedTransition::Vector::const_iterator transition = find_if(transitions.begin(), transitions.end(), boost::bind(boost::mem_fn(&TimedTransition::GetId), _1) == source);
-		TimedPlace::Vector::const_iterator place = find_if(places.begin(), places.end(), boost::bind(boost::mem_fn(&TimedPlace::GetId), _1) == target);
+		const boost::shared_ptr<TimedTransition>& transition = FindTransition(transitions, source);
+		const boost::shared_ptr<TimedPlace>& place = FindPlace(places, target);
+
+		return boost::make_shared<OutputArc>(transition, place);
 
-		return boost::make_shared<OutputArc>(*transition, *place);
+	}
 
+	const boost::shared_ptr<TimedPlace>& TAPNXmlParser::FindPlace(const PlaceMap& places, const std::string& id) const
+	{
+		PlaceMap::const_iterator iter = places.find(id);
+		if(iter == places.end()) throw std::string("unknown place " + id + ".");
+		return iter->second;
+	}
+
+	const boost::shared_ptr<TimedTransition>& TAPNXmlParser::FindTransition(const TransitionMap& transitions, const std::string& id) const
+	{
+		TransitionMap::const_iterator iter = transitions.find(id);
+		if(iter == transitions.end()) throw std::string("unknown transition " + id + ".");
+		return iter->second;
 	}
 
 	std::vector<int> TAPNXmlParser::ParseInitialMarking(const rapidxml::xml_node<>& root, const TimedArcPetriNet& tapn) const
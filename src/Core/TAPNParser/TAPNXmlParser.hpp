@@ -4,6 +4,8 @@
 #include "../TAPN/TAPN.hpp"
 
 #include <boost/smart_ptr.hpp>
+#include <boost/functional/hash.hpp>
+#include "google/sparse_hash_map"
 #include <rapidxml.hpp>
 
 namespace VerifyTAPN {
@@ -13,6 +15,10 @@ namespace VerifyTAPN {
 	class TAPNXmlParser
 	{
 	private:
+		// places and transitions by id
+		typedef google::sparse_hash_map<std::string, boost::shared_ptr<TimedPlace>, boost::hash<std::string> > PlaceMap;
+		typedef google::sparse_hash_map<std::string, boost::shared_ptr<TimedTransition>, boost::hash<std::string> > TransitionMap;
+
 		struct ArcCollections{
 			TimedInputArc::Vector inputArcs;
 			OutputArc::Vector outputArcs;
@@ -40,14 +46,16 @@ namespace VerifyTAPN {
 		boost::shared_ptr<TimedTransition> ParseTransition(const rapidxml::xml_node<>& transitionNode) const;
 
 		ArcCollections ParseArcs(const rapidxml::xml_node<>& root, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const;
-		TransportArc::Vector ParseTransportArcs(const rapidxml::xml_node<>& root, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const;
-		InhibitorArc::Vector ParseInhibitorArcs(const rapidxml::xml_node<>& root, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const;
-		TimedInputArc::Vector ParseInputArcs(const rapidxml::xml_node<>& root, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const;
-		OutputArc::Vector ParseOutputArcs(const rapidxml::xml_node<>& root, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const;
-		boost::shared_ptr<TimedInputArc> ParseInputArc(const rapidxml::xml_node<>& arcNode, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const;
-		boost::shared_ptr<InhibitorArc> ParseInhibitorArc(const rapidxml::xml_node<>& arcNode, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const;
-		boost::shared_ptr<TransportArc> ParseTransportArc(const rapidxml::xml_node<>& arcNode, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const;
-		boost::shared_ptr<OutputArc> ParseOutputArc(const rapidxml::xml_node<>& arcNode, const TimedPlace::Vector& places, const TimedTransition::Vector& transitions) const;
+		TransportArc::Vector ParseTransportArcs(const rapidxml::xml_node<>& root, const PlaceMap& places, const TransitionMap& transitions) const;
+		InhibitorArc::Vector ParseInhibitorArcs(const rapidxml::xml_node<>& root, const PlaceMap& places, const TransitionMap& transitions) const;
+		TimedInputArc::Vector ParseInputArcs(const rapidxml::xml_node<>& root, const PlaceMap& places, const TransitionMap& transitions) const;
+		OutputArc::Vector ParseOutputArcs(const rapidxml::xml_node<>& root, const PlaceMap& places, const TransitionMap& transitions) const;
+		boost::shared_ptr<TimedInputArc> ParseInputArc(const rapidxml::xml_node<>& arcNode, const PlaceMap& places, const TransitionMap& transitions) const;
+		boost::shared_ptr<InhibitorArc> ParseInhibitorArc(const rapidxml::xml_node<>& arcNode, const PlaceMap& places, const TransitionMap& transitions) const;
+		boost::shared_ptr<TransportArc> ParseTransportArc(const rapidxml::xml_node<>& arcNode, const PlaceMap& places, const TransitionMap& transitions) const;
+		boost::shared_ptr<OutputArc> ParseOutputArc(const rapidxml::xml_node<>& arcNode, const PlaceMap& places, const TransitionMap& transitions) const;
+		const boost::shared_ptr<TimedPlace>& FindPlace(const PlaceMap& places, const std::string& id) const;
+		const boost::shared_ptr<TimedTransition>& FindTransition(const TransitionMap& transitions, const std::string& id) const;
 		std::vector<int> ParseInitialMarking(const rapidxml::xml_node<>& root, const TimedArcPetriNet& tapn) const;
 	};
 }
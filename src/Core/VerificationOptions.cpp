@@ -14,6 +14,8 @@ namespace VerifyTAPN {
 
 	std::string SearchTypeEnumToString(SearchType s){
 		switch(s){
+		case QUERYDISTANCE:
+			return "Query Distance Search";
 		case COVERMOST:
 			return "Maximum Cover Search";
 		case RANDOM:
@@ -46,7 +48,13 @@ namespace VerifyTAPN {
 		if(options.GetTrace() != NONE) out << " in " << (options.XmlTrace() ? "xml format" : "human readable format");
 		out << std::endl;
 		out << "Symmetry Reduction is " << (options.GetSymmetryEnabled() ? "ON" : "OFF") << std::endl;
+		out << "Partial Order Reduction is " << (options.GetPartialOrderReductionEnabled() ? "ON" : "OFF") << std::endl;
+		if(options.GetSlicingEnabled())
+			out << "Slicing the net to the cone of influence of the query" << std::endl;
+		out << "State equation pre-check is " << (options.GetStateEquationEnabled() ? "ON" : "OFF") << std::endl;
 		out << "Untimed place optimization is " << (options.GetUntimedPlacesEnabled() ? "ON" : "OFF") << std::endl;
+		if(options.GetTimeIrrelevantPlacesEnabled())
+			out << "Ignoring the ages of tokens that cannot affect the query" << std::endl;
 		out << "Using " << (options.GetGlobalMaxConstantsEnabled() ? "global maximum constant" : "local maximum constants") << " for extrapolation" << std::endl;
 		out << "Using " << FactoryEnumToString(options.GetFactory()) << " marking factory" << std::endl;
 		if(options.GetFactory() == DISCRETE_INCLUSION){
@@ -64,6 +72,18 @@ namespace VerifyTAPN {
 			}
 			out << " for discrete inclusion." << std::endl;
 		}
+		if(options.GetExactPassedListEnabled())
+			out << "Using exact-match passed list with an inclusion window of " << options.GetInclusionWindow() << " markings" << std::endl;
+		if(options.GetKeptExpandedMarkings() > 0)
+			out << "Keeping up to " << options.GetKeptExpandedMarkings() << " waiting markings expanded" << std::endl;
+		if(options.GetUntimedMarkings() > 0)
+			out << "Exploring up to " << options.GetUntimedMarkings() << " untimed markings before the search" << std::endl;
+		if(options.GetCheckpointInterval() > 0)
+			out << "Writing a checkpoint to " << options.CheckpointFile() << " every " << options.GetCheckpointInterval() << " seconds" << std::endl;
+		if(options.Resume())
+			out << "Resuming from " << options.CheckpointFile() << std::endl;
+		if(options.GetStatisticsFormat() != NO_STATISTICS)
+			out << "Exporting transition statistics to " << options.StatisticsFile() << std::endl;
 		out << "Model file is: " << options.GetInputFile() << std::endl;
 		out << "Query file is: " << options.QueryFile() << std::endl;
 		return out;
@@ -7,8 +7,9 @@
 
 namespace VerifyTAPN {
 	enum Trace { NONE, SOME };
-	enum SearchType { BREADTHFIRST, DEPTHFIRST, RANDOM, COVERMOST };
+	enum SearchType { BREADTHFIRST, DEPTHFIRST, RANDOM, COVERMOST, QUERYDISTANCE };
 	enum Factory { DEFAULT, DISCRETE_INCLUSION, OLD_FACTORY };
+	enum StatisticsFormat { NO_STATISTICS, CSV_STATISTICS, JSON_STATISTICS };
 
 	class VerificationOptions {
 		public:
@@ -23,7 +24,20 @@ namespace VerifyTAPN {
 				bool useUntimedPlaces,
 				bool useGlobalMaxConstants,
 				Factory factory,
-				const std::vector<std::string>& inc_places
+				const std::vector<std::string>& inc_places,
+				unsigned int checkpointInterval,
+				bool resume,
+				unsigned int progressInterval,
+				bool jsonProgress,
+				StatisticsFormat statisticsFormat,
+				bool partialOrderReduction,
+				bool exactPassedList,
+				unsigned int inclusionWindow,
+				unsigned int keptExpandedMarkings,
+				bool slicing,
+				bool stateEquation,
+				unsigned int untimedMarkings,
+				bool timeIrrelevantPlaces
 			) :	inputFile(inputFile),
 				queryFile(queryFile),
 				searchType(searchType),
@@ -34,7 +48,20 @@ namespace VerifyTAPN {
 				useUntimedPlaces(useUntimedPlaces),
 				useGlobalMaxConstants(useGlobalMaxConstants),
 				factory(factory),
-				inc_places(inc_places)
+				inc_places(inc_places),
+				checkpointInterval(checkpointInterval),
+				resume(resume),
+				progressInterval(progressInterval),
+				jsonProgress(jsonProgress),
+				statisticsFormat(statisticsFormat),
+				partialOrderReduction(partialOrderReduction),
+				exactPassedList(exactPassedList),
+				inclusionWindow(inclusionWindow),
+				keptExpandedMarkings(keptExpandedMarkings),
+				slicing(slicing),
+				stateEquation(stateEquation),
+				untimedMarkings(untimedMarkings),
+				timeIrrelevantPlaces(timeIrrelevantPlaces)
 			{ };
 
 		public: // inspectors
@@ -44,6 +71,7 @@ namespace VerifyTAPN {
 			inline const Trace GetTrace() const { return trace; };
 			inline const bool XmlTrace() const { return xml_trace; };
 			inline const bool GetSymmetryEnabled() const { return symmetry; }
+			inline const bool GetPartialOrderReductionEnabled() const { return partialOrderReduction; }
 			inline const bool GetUntimedPlacesEnabled() const { return useUntimedPlaces; }
 			inline const bool GetGlobalMaxConstantsEnabled() const { return useGlobalMaxConstants; }
 			inline const SearchType GetSearchType() const { return searchType; }
@@ -51,6 +79,20 @@ namespace VerifyTAPN {
 			inline void SetFactory(Factory f) { factory = f; };
 			inline const std::vector<std::string>& GetIncPlaces() const { return inc_places; };
 			inline std::vector<std::string>& GetIncPlaces(){ return inc_places; };
+			inline const unsigned int GetCheckpointInterval() const { return checkpointInterval; };
+			inline const bool Resume() const { return resume; };
+			const std::string CheckpointFile() const { return queryFile + ".checkpoint"; };
+			inline const unsigned int GetProgressInterval() const { return progressInterval; };
+			inline const bool JsonProgress() const { return jsonProgress; };
+			inline const StatisticsFormat GetStatisticsFormat() const { return statisticsFormat; };
+			inline const bool GetExactPassedListEnabled() const { return exactPassedList; };
+			inline const unsigned int GetInclusionWindow() const { return inclusionWindow; };
+			inline const unsigned int GetKeptExpandedMarkings() const { return keptExpandedMarkings; };
+			inline const bool GetSlicingEnabled() const { return slicing; };
+			inline const bool GetStateEquationEnabled() const { return stateEquation; };
+			inline const unsigned int GetUntimedMarkings() const { return untimedMarkings; };
+			inline const bool GetTimeIrrelevantPlacesEnabled() const { return timeIrrelevantPlaces; };
+			const std::string StatisticsFile() const { return queryFile + (statisticsFormat == JSON_STATISTICS ? ".transitions.json" : ".transitions.csv"); };
 		private:
 			std::string inputFile;
 			std::string queryFile;
@@ -63,6 +105,19 @@ namespace VerifyTAPN {
 			bool useGlobalMaxConstants;
 			Factory factory;
 			std::vector<std::string> inc_places;
+			unsigned int checkpointInterval;
+			bool resume;
+			unsigned int progressInterval;
+			bool jsonProgress;
+			StatisticsFormat statisticsFormat;
+			bool partialOrderReduction;
+			bool exactPassedList;
+			unsigned int inclusionWindow;
+			unsigned int keptExpandedMarkings;
+			bool slicing;
+			bool stateEquation;
+			unsigned int untimedMarkings;
+			bool timeIrrelevantPlaces;
 	};
 
 	std::ostream& operator<<(std::ostream& out, const VerificationOptions& options);
@@ -1,74 +1,31 @@
 #ifndef MURMURHASH2NEUTRAL_HPP_
 #define MURMURHASH2NEUTRAL_HPP_
 
+#include <vector>
+
 //-----------------------------------------------------------------------------
 // MurmurHashNeutral2, by Austin Appleby
 
 // Same as MurmurHash2, but endian- and alignment-neutral.
 // Half the speed though, alas.
 
-//unsigned int MurmurHashNeutral2 ( const void * key, int len, unsigned int seed )
-//{
-//	const unsigned int m = 0x5bd1e995;
-//	const int r = 24;
-//
-//	unsigned int h = seed ^ len;
-//
-//	const unsigned char * data = (const unsigned char *)key;
-//
-//	while(len >= 4)
-//	{
-//		unsigned int k;
-//
-//		k  = data[0];
-//		k |= data[1] << 8;
-//		k |= data[2] << 16;
-//		k |= data[3] << 24;
-//
-//		k *= m;
-//		k ^= k >> r;
-//		k *= m;
-//
-//		h *= m;
-//		h ^= k;
-//
-//		data += 4;
-//		len -= 4;
-//	}
-//
-//	switch(len)
-//	{
-//	case 3: h ^= data[2] << 16;
-//	case 2: h ^= data[1] << 8;
-//	case 1: h ^= data[0];
-//	        h *= m;
-//	};
-//
-//	h ^= h >> 13;
-//	h *= m;
-//	h ^= h >> 15;
-//
-//	return h;
-//}
-
-inline unsigned int MurmurHashNeutral2 ( const std::vector<int>& key, unsigned int seed )
+inline unsigned int MurmurHashNeutral2 ( const void * key, int len, unsigned int seed )
 {
 	const unsigned int m = 0x5bd1e995;
 	const int r = 24;
-	int len = key.size();
-	unsigned int pos = 0;
 
 	unsigned int h = seed ^ len;
 
-	//const unsigned char * data = (const unsigned char *)key;
+	const unsigned char * data = (const unsigned char *)key;
+
 	while(len >= 4)
 	{
 		unsigned int k;
 
-		k  = key[pos];
-		k |= key[pos+1] << 8;
-		k |= key[pos+2] << 16;
-		k |= key[pos+3] << 24;
+		k  = data[0];
+		k |= data[1] << 8;
+		k |= data[2] << 16;
+		k |= data[3] << 24;
 
 		k *= m;
 		k ^= k >> r;
@@ -77,15 +34,15 @@ inline unsigned int MurmurHashNeutral2 ( const std::vector<int>& key, unsigned i
 		h *= m;
 		h ^= k;
 
-		pos += 4;
+		data += 4;
 		len -= 4;
 	}
 
 	switch(len)
 	{
-	case 3: h ^= key[pos+2] << 16;
-	case 2: h ^= key[pos+1] << 8;
-	case 1: h ^= key[pos];
+	case 3: h ^= data[2] << 16;
+	case 2: h ^= data[1] << 8;
+	case 1: h ^= data[0];
 	        h *= m;
 	};
 
@@ -96,4 +53,11 @@ inline unsigned int MurmurHashNeutral2 ( const std::vector<int>& key, unsigned i
 	return h;
 }
 
+// Hashes the elements of key as one block of bytes.
+inline unsigned int MurmurHashNeutral2 ( const std::vector<int>& key, unsigned int seed )
+{
+	if(key.empty()) return MurmurHashNeutral2(0, 0, seed);
+	return MurmurHashNeutral2(&key[0], static_cast<int>(key.size() * sizeof(int)), seed);
+}
+
 #endif /* MURMURHASH2NEUTRAL_HPP_ */
@@ -0,0 +1,68 @@
+#ifndef PLACEMENTHASH_HPP_
+#define PLACEMENTHASH_HPP_
+
+#include <vector>
+#include <stdint.h>
+#include "boost/functional/hash.hpp"
+#include "MurmurHash2Neutral.hpp"
+
+// Hash functions for placement vectors (and the inc vectors of discrete inclusion).
+// The one used by the verifier is selected at build time with
+// cmake -DVERIFYTAPN_Hash=MURMUR|WORD|BOOST, which defines VERIFYTAPN_HASH_<name>.
+// All of them are always available, so they can be compared by the hash benchmark.
+namespace VerifyTAPN {
+	// boost::hash_range, combining one element at a time.
+	inline size_t BoostPlacementHash(const std::vector<int>& placement, size_t seed = 0)
+	{
+		boost::hash_range(seed, placement.begin(), placement.end());
+		return seed;
+	}
+
+	// MurmurHashNeutral2 over the placement as one block of bytes.
+	inline size_t MurmurPlacementHash(const std::vector<int>& placement, size_t seed = 0)
+	{
+		uint64_t wide = static_cast<uint64_t>(seed);
+		return MurmurHashNeutral2(placement, static_cast<unsigned int>(wide ^ (wide >> 32)));
+	}
+
+	// Word-at-a-time multiply/xor-shift hash: two places are mixed per 64-bit
+	// multiply, followed by the splitmix64 finalizer.
+	inline size_t WordPlacementHash(const std::vector<int>& placement, size_t seed = 0)
+	{
+		const uint64_t m = 0x9E3779B97F4A7C15ULL;
+		uint64_t h = static_cast<uint64_t>(seed) ^ (placement.size() * m);
+
+		size_t i = 0;
+		for(; i + 1 < placement.size(); i += 2)
+		{
+			uint64_t k = static_cast<uint32_t>(placement[i]) | (static_cast<uint64_t>(static_cast<uint32_t>(placement[i+1])) << 32);
+			h = (h ^ k) * m;
+			h ^= h >> 32;
+		}
+		if(i < placement.size())
+		{
+			h = (h ^ static_cast<uint32_t>(placement[i])) * m;
+			h ^= h >> 32;
+		}
+
+		h ^= h >> 30;
+		h *= 0xBF58476D1CE4E5B9ULL;
+		h ^= h >> 27;
+		h *= 0x94D049BB133111EBULL;
+		h ^= h >> 31;
+		return static_cast<size_t>(h);
+	}
+
+	inline size_t HashPlacement(const std::vector<int>& placement, size_t seed = 0)
+	{
+#if defined(VERIFYTAPN_HASH_BOOST)
+		return BoostPlacementHash(placement, seed);
+#elif defined(VERIFYTAPN_HASH_WORD)
+		return WordPlacementHash(placement, seed);
+#else
+		return MurmurPlacementHash(placement, seed);
+#endif
+	}
+}
+
+#endif /* PLACEMENTHASH_HPP_ */
@@ -0,0 +1,206 @@
+#include "LinearProgram.hpp"
+#include <limits>
+#include "assert.h"
+
+namespace VerifyTAPN {
+	static const long long MAX_VALUE = std::numeric_limits<long long>::max();
+
+	bool CheckedAdd(long long a, long long b, long long& result)
+	{
+		if((b > 0 && a > MAX_VALUE - b) || (b < 0 && a < -MAX_VALUE - b)) return false;
+		result = a + b;
+		return true;
+	}
+
+	bool CheckedSubtract(long long a, long long b, long long& result)
+	{
+		if((b > 0 && a < -MAX_VALUE + b) || (b < 0 && a > MAX_VALUE + b)) return false;
+		result = a - b;
+		return true;
+	}
+
+	bool CheckedMultiply(long long a, long long b, long long& result)
+	{
+		if(a == 0 || b == 0)
+		{
+			result = 0;
+			return true;
+		}
+		long long absA = a < 0 ? -a : a, absB = b < 0 ? -b : b;
+		if(absA > MAX_VALUE / absB) return false;
+		result = a * b;
+		return true;
+	}
+
+	static long long Gcd(long long a, long long b)
+	{
+		if(a < 0) a = -a;
+		if(b < 0) b = -b;
+		while(b != 0)
+		{
+			long long r = a % b;
+			a = b;
+			b = r;
+		}
+		return a;
+	}
+
+	// Divides a row by the gcd of its entries, keeping the entries as small as possible.
+	static void Normalize(std::vector<long long>& row)
+	{
+		long long gcd = 0;
+		for(std::vector<long long>::const_iterator it = row.begin(); it != row.end() && gcd != 1; ++it)
+			gcd = Gcd(gcd, *it);
+		if(gcd > 1)
+		{
+			for(std::vector<long long>::iterator it = row.begin(); it != row.end(); ++it)
+				*it /= gcd;
+		}
+	}
+
+	void LinearProgram::AddConstraint(const std::vector<long long>& coefficients, Relation relation, long long bound)
+	{
+		assert(coefficients.size() == variables);
+		constraints.push_back(Constraint(coefficients, relation, bound));
+	}
+
+	LinearProgram::Result LinearProgram::IsIntegerFeasible() const
+	{
+		std::vector<Constraint> system(constraints);
+		unsigned int nodes = 0;
+		long long budget = MAX_WORK;
+		return BranchAndBound(system, nodes, budget);
+	}
+
+	LinearProgram::Result LinearProgram::BranchAndBound(std::vector<Constraint>& system, unsigned int& nodes, long long& budget) const
+	{
+		if(++nodes > MAX_NODES) return UNKNOWN;
+
+		std::vector<long long> numerators, denominators;
+		Result relaxed = SolveRelaxation(system, numerators, denominators, budget);
+		if(relaxed != FEASIBLE) return relaxed;
+
+		for(unsigned int j = 0; j < variables; j++)
+		{
+			if(numerators[j] % denominators[j] == 0) continue;
+
+			// split on the first fractional variable: x_j <= floor or x_j >= floor + 1
+			long long floor = numerators[j] / denominators[j];
+			if(floor == MAX_VALUE) return UNKNOWN;
+			std::vector<long long> unit(variables, 0);
+			unit[j] = 1;
+			system.push_back(Constraint(unit, LESS_EQUAL, floor));
+			Result down = BranchAndBound(system, nodes, budget);
+			system.pop_back();
+			if(down != INFEASIBLE) return down;
+
+			unit[j] = -1;
+			system.push_back(Constraint(unit, LESS_EQUAL, -(floor + 1)));
+			Result up = BranchAndBound(system, nodes, budget);
+			system.pop_back();
+			return up;
+		}
+		return FEASIBLE;
+	}
+
+	// Phase one of the simplex method: minimizes the sum of artificial variables
+	// added to the rows that have no slack variable to start the basis with. Each
+	// row i stores an integer multiple of its equation, with a positive coefficient
+	// for its basic variable, so the value of that variable is rhs / coefficient.
+	LinearProgram::Result LinearProgram::SolveRelaxation(const std::vector<Constraint>& system, std::vector<long long>& numerators, std::vector<long long>& denominators, long long& budget) const
+	{
+		unsigned int rows = system.size();
+		unsigned int slacks = 0, artificials = 0;
+		for(std::vector<Constraint>::const_iterator it = system.begin(); it != system.end(); ++it)
+		{
+			if(it->relation == LESS_EQUAL) slacks++;
+			if(it->relation == EQUAL || it->bound < 0) artificials++;
+		}
+		unsigned int firstArtificial = variables + slacks;
+		unsigned int rhs = firstArtificial + artificials;
+		unsigned int columns = rhs + 1;
+
+		std::vector< std::vector<long long> > tableau(rows, std::vector<long long>(columns, 0));
+		std::vector<long long> objective(columns, 0);
+		std::vector<unsigned int> basis(rows);
+		unsigned int slack = variables, artificial = firstArtificial;
+		for(unsigned int i = 0; i < rows; i++)
+		{
+			const Constraint& constraint = system[i];
+			long long sign = constraint.bound < 0 ? -1 : 1;
+			std::vector<long long>& row = tableau[i];
+			for(unsigned int j = 0; j < variables; j++) row[j] = sign * constraint.coefficients[j];
+			row[rhs] = sign * constraint.bound;
+			if(constraint.relation == LESS_EQUAL) row[slack++] = sign;
+
+			if(constraint.relation == LESS_EQUAL && sign > 0)
+			{
+				basis[i] = slack - 1;
+			}
+			else
+			{
+				row[artificial] = 1;
+				basis[i] = artificial++;
+				for(unsigned int j = 0; j < columns; j++)
+				{
+					if((j < firstArtificial || j == rhs) && !CheckedSubtract(objective[j], row[j], objective[j])) return UNKNOWN;
+				}
+			}
+		}
+
+		while(true)
+		{
+			unsigned int entering = 0;
+			while(entering < rhs && objective[entering] >= 0) entering++;
+			if(entering == rhs) break; // optimal
+
+			unsigned int leaving = rows;
+			for(unsigned int i = 0; i < rows; i++)
+			{
+				if(tableau[i][entering] <= 0) continue;
+				if(leaving == rows)
+				{
+					leaving = i;
+					continue;
+				}
+				long long ratio, best;
+				if(!CheckedMultiply(tableau[i][rhs], tableau[leaving][entering], ratio) || !CheckedMultiply(tableau[leaving][rhs], tableau[i][entering], best)) return UNKNOWN;
+				if(ratio < best || (ratio == best && basis[i] < basis[leaving])) leaving = i;
+			}
+			if(leaving == rows) return UNKNOWN; // cannot happen, the objective is bounded below by zero
+
+			budget -= static_cast<long long>(rows + 1) * columns;
+			if(budget < 0) return UNKNOWN;
+
+			const std::vector<long long>& pivotRow = tableau[leaving];
+			long long pivot = pivotRow[entering];
+			for(unsigned int i = 0; i <= rows; i++)
+			{
+				std::vector<long long>& row = i < rows ? tableau[i] : objective;
+				if(i == leaving || row[entering] == 0) continue;
+
+				long long factor = row[entering];
+				for(unsigned int j = 0; j < columns; j++)
+				{
+					long long scaled, eliminated;
+					if(!CheckedMultiply(row[j], pivot, scaled) || !CheckedMultiply(pivotRow[j], factor, eliminated) || !CheckedSubtract(scaled, eliminated, row[j])) return UNKNOWN;
+				}
+				Normalize(row);
+			}
+			Normalize(tableau[leaving]);
+			basis[leaving] = entering;
+		}
+
+		if(objective[rhs] != 0) return INFEASIBLE;
+
+		numerators.assign(variables, 0);
+		denominators.assign(variables, 1);
+		for(unsigned int i = 0; i < rows; i++)
+		{
+			if(basis[i] >= variables) continue;
+			numerators[basis[i]] = tableau[i][rhs];
+			denominators[basis[i]] = tableau[i][basis[i]];
+		}
+		return FEASIBLE;
+	}
+}
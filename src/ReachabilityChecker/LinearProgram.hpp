@@ -0,0 +1,51 @@
+#ifndef LINEARPROGRAM_HPP_
+#define LINEARPROGRAM_HPP_
+
+#include <vector>
+
+namespace VerifyTAPN {
+	// Arithmetic on long long that returns false instead of overflowing. Results
+	// stay within [-max, max], so they can always be negated.
+	bool CheckedAdd(long long a, long long b, long long& result);
+	bool CheckedSubtract(long long a, long long b, long long& result);
+	bool CheckedMultiply(long long a, long long b, long long& result);
+
+	// Decides whether a system of linear constraints over non-negative integer
+	// variables has a solution. The LP relaxation is solved exactly by the simplex
+	// method (Bland's rule) on a fraction-free integer tableau, and integrality is
+	// enforced by a small branch and bound. If a limit is hit or a tableau entry
+	// would overflow, the answer is UNKNOWN, so INFEASIBLE is always a proof.
+	class LinearProgram
+	{
+	public:
+		enum Relation { LESS_EQUAL, EQUAL };
+		enum Result { FEASIBLE, INFEASIBLE, UNKNOWN };
+
+	public:
+		explicit LinearProgram(unsigned int variables) : variables(variables), constraints() { };
+
+		void AddConstraint(const std::vector<long long>& coefficients, Relation relation, long long bound);
+		Result IsIntegerFeasible() const;
+
+	private:
+		struct Constraint {
+			std::vector<long long> coefficients;
+			Relation relation;
+			long long bound;
+
+			Constraint(const std::vector<long long>& coefficients, Relation relation, long long bound) : coefficients(coefficients), relation(relation), bound(bound) { };
+		};
+
+		Result BranchAndBound(std::vector<Constraint>& constraints, unsigned int& nodes, long long& budget) const;
+		Result SolveRelaxation(const std::vector<Constraint>& constraints, std::vector<long long>& numerators, std::vector<long long>& denominators, long long& budget) const;
+
+	private:
+		static const unsigned int MAX_NODES = 64;
+		static const long long MAX_WORK = 1LL << 28; // tableau entries updated over all pivots
+
+		unsigned int variables;
+		std::vector<Constraint> constraints;
+	};
+}
+
+#endif /* LINEARPROGRAM_HPP_ */
@@ -0,0 +1,124 @@
+#ifndef BUCKETWAITINGLIST_HPP_
+#define BUCKETWAITINGLIST_HPP_
+
+#include "WaitingList.hpp"
+#include <vector>
+#include <deque>
+#include "Node.hpp"
+#include "assert.h"
+
+namespace VerifyTAPN {
+
+	// Priority waiting list for small non-negative integer weights (e.g. bounded by k).
+	// Nodes are kept in one FIFO bucket per weight and the highest weight is always
+	// served first, so Add and Next are O(1) (amortized over the buckets skipped
+	// when the top bucket runs empty) and no wrapper is allocated per node.
+	template <typename CalcWeight>
+	class BucketWaitingList : public VerifyTAPN::WaitingList {
+	public:
+		typedef std::deque<NodeIndex> bucket;
+	public:
+		explicit BucketWaitingList(NodeStore& nodes) : WaitingList(nodes), calcWeight(), buckets(), top(0), totalSize(0), actualSize(0) { };
+		virtual ~BucketWaitingList() { };
+	public:
+		virtual void Add(NodeIndex node);
+		virtual NodeIndex Next();
+		virtual long long Size() const { return actualSize; };
+		inline virtual long long SizeIncludingCovered() const { return totalSize; };
+		inline virtual void DecrementActualSize() { actualSize--; if(ShouldCompact(actualSize)) Compact(); };
+		virtual void CollectWaitingNodes(std::vector<NodeIndex>& waiting) const;
+	private:
+		void Compact();
+
+	private:
+		CalcWeight calcWeight;
+		std::vector<bucket> buckets;
+		unsigned int top; // highest weight that may have a non-empty bucket
+		long long totalSize;
+		long long actualSize;
+	};
+
+	template <typename CalcWeight>
+	void BucketWaitingList<CalcWeight>::Add(NodeIndex node)
+	{
+		if(node != NodeStore::NO_NODE){
+			assert(nodes[node].GetColor()==WAITING);
+			int weight = calcWeight(nodes[node]);
+			assert(weight >= 0);
+			unsigned int index = static_cast<unsigned int>(weight);
+			if(index >= buckets.size()) buckets.resize(index+1);
+
+			buckets[index].push_back(node);
+			if(index > top) top = index;
+			totalSize++;
+			actualSize++;
+		}
+	}
+
+	template <typename CalcWeight>
+	NodeIndex BucketWaitingList<CalcWeight>::Next()
+	{
+		if(Size() == 0) return NodeStore::NO_NODE;
+
+		while(true)
+		{
+			while(buckets[top].empty())
+			{
+				assert(top > 0);
+				top--;
+			}
+
+			NodeIndex node = buckets[top].front();
+			buckets[top].pop_front();
+			totalSize--;
+
+			assert(nodes[node].GetColor() == WAITING || nodes[node].GetColor() == COVERED);
+			if(nodes[node].GetColor() == COVERED)
+			{
+				nodes.Free(node);
+				continue;
+			}
+
+			actualSize--;
+			nodes[node].Recolor(PASSED);
+			return node;
+		}
+	}
+
+	template <typename CalcWeight>
+	void BucketWaitingList<CalcWeight>::CollectWaitingNodes(std::vector<NodeIndex>& waiting) const
+	{
+		for(typename std::vector<bucket>::const_iterator b = buckets.begin(); b != buckets.end(); b++)
+		{
+			for(bucket::const_iterator it = b->begin(); it != b->end(); it++)
+			{
+				if(nodes[*it].GetColor() == WAITING) waiting.push_back(*it);
+			}
+		}
+	}
+
+	template <typename CalcWeight>
+	void BucketWaitingList<CalcWeight>::Compact()
+	{
+		for(typename std::vector<bucket>::iterator b = buckets.begin(); b != buckets.end(); b++)
+		{
+			bucket::iterator dest = b->begin();
+			for(bucket::iterator it = b->begin(); it != b->end(); it++)
+			{
+				if(nodes[*it].GetColor() == COVERED)
+				{
+					nodes.Free(*it);
+				}
+				else
+				{
+					*dest = *it;
+					dest++;
+				}
+			}
+			b->erase(dest, b->end());
+		}
+		totalSize = actualSize;
+	}
+}
+
+#endif /* BUCKETWAITINGLIST_HPP_ */
@@ -0,0 +1,166 @@
+#include "ExactPWList.hpp"
+#include "../../Core/SymbolicMarking/MarkingFactory.hpp"
+#include "../../Core/BinaryStream.hpp"
+#include "../../Core/Profiler.hpp"
+
+namespace VerifyTAPN {
+	ExactPWList::~ExactPWList()
+	{
+		delete waitingList;
+	}
+
+	bool ExactPWList::Add(const SymbolicMarking& symMarking)
+	{
+		return Insert(symMarking) != NodeStore::NO_NODE;
+	}
+
+	bool ExactPWList::Add(SymbolicMarking* symMarking, bool& kept)
+	{
+		NodeIndex node = Insert(*symMarking);
+		kept = node != NodeStore::NO_NODE && nodes.ExpandedSize() < maxExpanded;
+		if(kept) nodes.KeepExpanded(node, symMarking);
+		return node != NodeStore::NO_NODE;
+	}
+
+	NodeIndex ExactPWList::Insert(const SymbolicMarking& symMarking)
+	{
+		StoredMarking* storedMarking;
+		{
+			PROFILE_SCOPE(CONVERT);
+			storedMarking = factory->Convert(const_cast<SymbolicMarking*>(&symMarking));
+		}
+		PROFILE_SCOPE(INCLUSION_CHECK);
+		stats.discoveredStates++;
+
+		unsigned int hash = static_cast<unsigned int>(storedMarking->ExactHashKey());
+		if(Contains(*storedMarking, hash) || IsIncluded(*storedMarking))
+		{
+			PROFILE_COUNT(SUBSUMED);
+			factory->Release(storedMarking);
+			return NodeStore::NO_NODE;
+		}
+
+		stats.storedStates++;
+		NodeIndex node = Store(storedMarking, hash, WAITING);
+		waitingList->Add(node);
+		return node;
+	}
+
+	bool ExactPWList::Contains(const StoredMarking& marking, unsigned int hash) const
+	{
+		size_t mask = table.size() - 1;
+		for(size_t i = hash & mask; table[i].node != NodeStore::NO_NODE; i = (i + 1) & mask)
+		{
+			if(table[i].hash == hash && marking.Equals(*nodes[table[i].node].GetMarking())) return true;
+		}
+		return false;
+	}
+
+	bool ExactPWList::IsIncluded(const StoredMarking& marking)
+	{
+		if(inclusionWindow == 0) return false;
+
+		WindowMap::const_iterator window = windows.find(marking.HashKey());
+		if(window == windows.end()) return false;
+
+		for(NodeWindow::const_reverse_iterator iter = window->second.rbegin(); iter != window->second.rend(); ++iter)
+		{
+			PROFILE_COUNT(RELATION_CHECKS);
+			if((marking.Relation(*nodes[*iter].GetMarking()) & SUBSET) != 0) return true;
+		}
+		return false;
+	}
+
+	NodeIndex ExactPWList::Store(StoredMarking* marking, unsigned int hash, Color color)
+	{
+		if(2 * (count + 1) > table.size()) Grow();
+
+		size_t mask = table.size() - 1;
+		size_t i = hash & mask;
+		while(table[i].node != NodeStore::NO_NODE) i = (i + 1) & mask;
+
+		NodeIndex node = nodes.Allocate(marking, color);
+		table[i].hash = hash;
+		table[i].node = node;
+		count++;
+
+		if(inclusionWindow > 0)
+		{
+			NodeWindow& window = windows[marking->HashKey()];
+			window.push_back(node);
+			if(window.size() > inclusionWindow) window.pop_front();
+		}
+		return node;
+	}
+
+	void ExactPWList::Grow()
+	{
+		std::vector<Entry> old(table.size() * 2);
+		old.swap(table);
+
+		size_t mask = table.size() - 1;
+		for(std::vector<Entry>::const_iterator iter = old.begin(); iter != old.end(); ++iter)
+		{
+			if(iter->node == NodeStore::NO_NODE) continue;
+
+			size_t i = iter->hash & mask;
+			while(table[i].node != NodeStore::NO_NODE) i = (i + 1) & mask;
+			table[i] = *iter;
+		}
+	}
+
+	SymbolicMarking* ExactPWList::GetNextUnexplored()
+	{
+		stats.exploredStates++;
+		NodeIndex next = waitingList->Next();
+		SymbolicMarking* expanded = nodes.TakeExpanded(next);
+		if(expanded != 0) return expanded;
+		return factory->Convert(nodes[next].GetMarking());
+	}
+
+	void ExactPWList::Print() const
+	{
+		std::cout << stats;
+		std::cout << ", waitingList: " << waitingList->Size() << "/" << waitingList->SizeIncludingCovered();
+	}
+
+	// Same layout as PWList::Save, so checkpoints can be resumed with either list.
+	void ExactPWList::Save(BinaryWriter& out) const
+	{
+		out.Write(stats);
+
+		std::vector<NodeIndex> waiting;
+		waitingList->CollectWaitingNodes(waiting);
+		out.Write<long long>(waiting.size());
+		for(std::vector<NodeIndex>::const_iterator it = waiting.begin(); it != waiting.end(); ++it)
+		{
+			factory->Write(out, *nodes[*it].GetMarking());
+		}
+
+		out.Write<long long>(stats.storedStates - waiting.size());
+		for(std::vector<Entry>::const_iterator iter = table.begin(); iter != table.end(); ++iter)
+		{
+			if(iter->node != NodeStore::NO_NODE && nodes[iter->node].GetColor() == PASSED) factory->Write(out, *nodes[iter->node].GetMarking());
+		}
+	}
+
+	void ExactPWList::Load(BinaryReader& in)
+	{
+		assert(stats.storedStates == 0);
+		stats = in.Read<Stats>();
+
+		long long waiting = in.Read<long long>();
+		for(long long i = 0; i < waiting; i++)
+		{
+			StoredMarking* marking = factory->Read(in);
+			waitingList->Add(Store(marking, static_cast<unsigned int>(marking->ExactHashKey()), WAITING));
+		}
+
+		long long passed = in.Read<long long>();
+		for(long long i = 0; i < passed; i++)
+		{
+			StoredMarking* marking = factory->Read(in);
+			Store(marking, static_cast<unsigned int>(marking->ExactHashKey()), PASSED);
+		}
+	}
+}
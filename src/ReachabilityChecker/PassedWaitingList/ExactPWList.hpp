@@ -0,0 +1,74 @@
+#ifndef EXACTPWLIST_HPP_
+#define EXACTPWLIST_HPP_
+
+#include "google/sparse_hash_map"
+#include <vector>
+#include <deque>
+#include "PassedWaitingList.hpp"
+#include "NodeStore.hpp"
+#include "WaitingList.hpp"
+
+namespace VerifyTAPN {
+	class SymbolicMarking;
+	class MarkingFactory;
+
+	// Passed-waiting list that only detects exact duplicates. Stored markings are
+	// kept in an open-addressed hash table keyed on the hash of both the discrete
+	// part and the zone, so a lookup does not have to scan all zones stored for
+	// the same discrete part as PWList does. Optionally, a new marking is also
+	// checked for inclusion in the last few markings stored with the same discrete
+	// part. Stored markings are never covered by newer ones.
+	class ExactPWList : public PassedWaitingList {
+	private:
+		struct Entry {
+			unsigned int hash; // low bits of the marking's exact hash key
+			NodeIndex node;
+
+			Entry() : hash(0), node(NodeStore::NO_NODE) { };
+		};
+		typedef std::deque<NodeIndex> NodeWindow;
+		typedef google::sparse_hash_map<size_t, NodeWindow> WindowMap;
+	public:
+		ExactPWList(NodeStore& nodes, WaitingList* waitingList, MarkingFactory* factory, unsigned int inclusionWindow, unsigned int maxExpanded)
+			: table(INITIAL_CAPACITY), count(0), windows(), inclusionWindow(inclusionWindow), stats(), nodes(nodes), waitingList(waitingList), factory(factory), maxExpanded(maxExpanded) {};
+		virtual ~ExactPWList();
+
+	public: // inspectors
+		virtual bool HasWaitingStates() const { return waitingList->Size() > 0; };
+		virtual long long WaitingSize() const { return waitingList->Size(); };
+		virtual long long WaitingSizeIncludingCovered() const { return waitingList->SizeIncludingCovered(); };
+		virtual long long Size() const { return count; };
+		virtual Stats GetStats() const { return stats; };
+
+		virtual void Print() const;
+
+	public: // modifiers
+		virtual bool Add(const SymbolicMarking& symMarking);
+		virtual bool Add(SymbolicMarking* symMarking, bool& kept);
+		virtual SymbolicMarking* GetNextUnexplored();
+
+		virtual void Save(BinaryWriter& out) const;
+		virtual void Load(BinaryReader& in);
+	private:
+		NodeIndex Insert(const SymbolicMarking& symMarking);
+		bool Contains(const StoredMarking& marking, unsigned int hash) const;
+		bool IsIncluded(const StoredMarking& marking);
+		NodeIndex Store(StoredMarking* marking, unsigned int hash, Color color);
+		void Grow();
+
+	private:
+		static const size_t INITIAL_CAPACITY = 1 << 16; // must be a power of two
+
+		std::vector<Entry> table; // linear probing, kept at most half full
+		size_t count;
+		WindowMap windows; // per discrete part: the most recently stored nodes
+		unsigned int inclusionWindow;
+		Stats stats;
+		NodeStore& nodes;
+		WaitingList* waitingList;
+		MarkingFactory* factory;
+		unsigned int maxExpanded; // waiting nodes that may keep their marking in expanded form
+	};
+}
+
+#endif /* EXACTPWLIST_HPP_ */
@@ -5,19 +5,28 @@
 
 namespace VerifyTAPN
 {
+	class SymbolicMarking;
+
 	enum Color { WAITING, PASSED, COVERED };
 
+	// Nodes are owned by a NodeStore, which deletes their markings. A waiting node
+	// may also hold the marking it was stored from, which is then explored instead
+	// of converting the stored marking back.
 	class Node{
 	public:
-		Node(StoredMarking* marking, Color color) : marking(marking), color(color) {};
-		virtual ~Node() { delete marking; };
+		Node() : marking(0), expanded(0), color(WAITING) {};
+		Node(StoredMarking* marking, Color color) : marking(marking), expanded(0), color(color) {};
 		inline Color GetColor() const { return color; };
 		inline StoredMarking* GetMarking() const { return marking; };
+		inline SymbolicMarking* GetExpanded() const { return expanded; };
 	public:
 		inline void Recolor(Color newColor) { color = newColor; };
 	private:
 		StoredMarking* marking;
+		SymbolicMarking* expanded;
 		Color color;
+
+		friend class NodeStore;
 	};
 }
 
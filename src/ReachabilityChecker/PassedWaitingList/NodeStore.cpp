@@ -0,0 +1,72 @@
+#include "NodeStore.hpp"
+#include "../../Core/SymbolicMarking/SymbolicMarking.hpp"
+#include "assert.h"
+
+namespace VerifyTAPN
+{
+	const NodeIndex NodeStore::NO_NODE;
+
+	NodeStore::~NodeStore()
+	{
+		for(NodeIndex i = 0; i < allocated; i++)
+		{
+			ReleaseMarking(i); // freed slots no longer have a marking
+		}
+		for(std::vector<Node*>::iterator it = chunks.begin(); it != chunks.end(); ++it)
+		{
+			delete [] *it;
+		}
+	}
+
+	NodeIndex NodeStore::Allocate(StoredMarking* marking, Color color)
+	{
+		NodeIndex index;
+		if(!freeSlots.empty())
+		{
+			index = freeSlots.back();
+			freeSlots.pop_back();
+		}
+		else
+		{
+			assert(allocated != NO_NODE);
+			index = allocated++;
+			if((index >> CHUNK_BITS) == chunks.size()) chunks.push_back(new Node[CHUNK_SIZE]);
+		}
+		(*this)[index] = Node(marking, color);
+		return index;
+	}
+
+	void NodeStore::Free(NodeIndex index)
+	{
+		ReleaseMarking(index);
+		freeSlots.push_back(index);
+	}
+
+	void NodeStore::ReleaseMarking(NodeIndex index)
+	{
+		Node& node = (*this)[index];
+		delete node.marking;
+		node.marking = 0;
+		delete TakeExpanded(index);
+	}
+
+	void NodeStore::KeepExpanded(NodeIndex index, SymbolicMarking* marking)
+	{
+		Node& node = (*this)[index];
+		assert(node.expanded == 0 && node.color == WAITING);
+		node.expanded = marking;
+		expanded++;
+	}
+
+	SymbolicMarking* NodeStore::TakeExpanded(NodeIndex index)
+	{
+		Node& node = (*this)[index];
+		SymbolicMarking* marking = node.expanded;
+		if(marking != 0)
+		{
+			node.expanded = 0;
+			expanded--;
+		}
+		return marking;
+	}
+}
@@ -0,0 +1,52 @@
+#ifndef NODESTORE_HPP_
+#define NODESTORE_HPP_
+
+#include <vector>
+#include "Node.hpp"
+
+namespace VerifyTAPN
+{
+	typedef unsigned int NodeIndex;
+
+	// Arena for the nodes of the passed-waiting list. Nodes live in fixed-size
+	// chunks and are referred to by 32-bit indices, so the waiting lists and the
+	// passed list hold 4 bytes per entry and a node never moves once allocated.
+	// Slots of freed nodes are reused. The store owns the markings of its nodes,
+	// including the expanded markings kept on waiting nodes.
+	class NodeStore {
+	public:
+		static const NodeIndex NO_NODE = static_cast<NodeIndex>(-1);
+	public:
+		NodeStore() : chunks(), freeSlots(), allocated(0), expanded(0) { };
+		~NodeStore();
+
+	public:
+		NodeIndex Allocate(StoredMarking* marking, Color color);
+		void Free(NodeIndex index);
+		void ReleaseMarking(NodeIndex index); // covered nodes are never explored, so their markings can go right away
+
+		void KeepExpanded(NodeIndex index, SymbolicMarking* marking);
+		SymbolicMarking* TakeExpanded(NodeIndex index); // hands the expanded marking (if any) over to the caller
+
+		inline Node& operator[](NodeIndex index) { return chunks[index >> CHUNK_BITS][index & CHUNK_MASK]; };
+		inline const Node& operator[](NodeIndex index) const { return chunks[index >> CHUNK_BITS][index & CHUNK_MASK]; };
+		inline long long Size() const { return allocated - freeSlots.size(); };
+		inline long long ExpandedSize() const { return expanded; };
+
+	private:
+		NodeStore(const NodeStore&);
+		NodeStore& operator=(const NodeStore&);
+
+	private:
+		static const unsigned int CHUNK_BITS = 16;
+		static const unsigned int CHUNK_SIZE = 1u << CHUNK_BITS;
+		static const unsigned int CHUNK_MASK = CHUNK_SIZE - 1;
+
+		std::vector<Node*> chunks;
+		std::vector<NodeIndex> freeSlots;
+		NodeIndex allocated; // slots handed out so far, including freed ones
+		long long expanded; // nodes currently holding an expanded marking
+	};
+}
+
+#endif /* NODESTORE_HPP_ */
@@ -1,24 +1,36 @@
 #include "PWList.hpp"
 #include "../../Core/SymbolicMarking/MarkingFactory.hpp"
 #include "../../Core/SymbolicMarking/DiscreteMarking.hpp"
+#include "../../Core/BinaryStream.hpp"
+#include "../../Core/Profiler.hpp"
 
 namespace VerifyTAPN {
 	PWList::~PWList()
 	{
 		 delete waitingList;
-		 for(HashMap::iterator iter = map.begin(); iter != map.end(); ++iter){
-			NodeList& list = (*iter).second;
-
-			 for(NodeList::iterator iter = list.begin(); iter != list.end(); ++iter){
-				 Node* node = *iter;
-				 delete node;
-			 }
-		 }
 	}
 
 	bool PWList::Add(const SymbolicMarking& symMarking)
 	{
-		StoredMarking* storedMarking = factory->Convert(const_cast<SymbolicMarking*>(&symMarking));
+		return Insert(symMarking) != NodeStore::NO_NODE;
+	}
+
+	bool PWList::Add(SymbolicMarking* symMarking, bool& kept)
+	{
+		NodeIndex node = Insert(*symMarking);
+		kept = node != NodeStore::NO_NODE && nodes.ExpandedSize() < maxExpanded;
+		if(kept) nodes.KeepExpanded(node, symMarking);
+		return node != NodeStore::NO_NODE;
+	}
+
+	NodeIndex PWList::Insert(const SymbolicMarking& symMarking)
+	{
+		StoredMarking* storedMarking;
+		{
+			PROFILE_SCOPE(CONVERT);
+			storedMarking = factory->Convert(const_cast<SymbolicMarking*>(&symMarking));
+		}
+		PROFILE_SCOPE(INCLUSION_CHECK);
 		stats.discoveredStates++;
 		//const DiscretePart& dp = symMarking.GetDiscretePart();
 		NodeList& markings = map[storedMarking->HashKey()];
@@ -26,25 +38,29 @@ namespace VerifyTAPN {
 
 		while(iter != markings.end())
 		{
-			Node* currentNode 		= *iter;
-			relation relation 	= storedMarking->Relation(*currentNode->GetMarking());
+			Node& currentNode 		= nodes[*iter];
+			relation relation 	= storedMarking->Relation(*currentNode.GetMarking());
+			PROFILE_COUNT(RELATION_CHECKS);
 			//assert(eqdp()(currentNode->GetMarking().GetDiscretePart(), dp));
 			if((relation & SUBSET) != 0)
 			{ // check subseteq
+				PROFILE_COUNT(SUBSUMED);
 				factory->Release(storedMarking);
-				return false;
+				return NodeStore::NO_NODE;
 			}
 			else if(relation == SUPERSET)
 			{
-				assert(currentNode->GetColor() != COVERED);
-				if(currentNode->GetColor() == WAITING)
+				assert(currentNode.GetColor() != COVERED);
+				PROFILE_COUNT(COVERED);
+				if(currentNode.GetColor() == WAITING)
 				{
+					currentNode.Recolor(COVERED);
+					nodes.ReleaseMarking(*iter);
 					waitingList->DecrementActualSize();
-					currentNode->Recolor(COVERED);
 				}
 				else
 				{
-					delete currentNode;
+					nodes.Free(*iter);
 				}
 				iter = markings.erase(iter);
 				stats.storedStates--;
@@ -54,11 +70,11 @@ namespace VerifyTAPN {
 		}
 
 		stats.storedStates++;
-		Node* node = new Node(storedMarking, WAITING);
+		NodeIndex node = nodes.Allocate(storedMarking, WAITING);
 		markings.push_back(node);
 		waitingList->Add(node);
 
-		return true;
+		return node;
 	}
 
 	long long PWList::Size() const
@@ -74,8 +90,10 @@ namespace VerifyTAPN {
 	SymbolicMarking* PWList::GetNextUnexplored()
 	{
 		stats.exploredStates++;
-		StoredMarking* next = waitingList->Next()->GetMarking();
-		return factory->Convert(next);
+		NodeIndex next = waitingList->Next();
+		SymbolicMarking* expanded = nodes.TakeExpanded(next);
+		if(expanded != 0) return expanded;
+		return factory->Convert(nodes[next].GetMarking());
 	}
 
 	Stats PWList::GetStats() const
@@ -88,4 +106,51 @@ namespace VerifyTAPN {
 		std::cout << stats;
 		std::cout << ", waitingList: " << waitingList->Size() << "/" << waitingList->SizeIncludingCovered();
 	}
+
+	// The waiting nodes are written first in waiting list order, followed by the
+	// passed nodes. Covered nodes are no longer part of the state space and are skipped.
+	void PWList::Save(BinaryWriter& out) const
+	{
+		out.Write(stats);
+
+		std::vector<NodeIndex> waiting;
+		waitingList->CollectWaitingNodes(waiting);
+		out.Write<long long>(waiting.size());
+		for(std::vector<NodeIndex>::const_iterator it = waiting.begin(); it != waiting.end(); ++it)
+		{
+			factory->Write(out, *nodes[*it].GetMarking());
+		}
+
+		out.Write<long long>(stats.storedStates - waiting.size());
+		for(HashMap::const_iterator iter = map.begin(); iter != map.end(); ++iter)
+		{
+			const NodeList& list = (*iter).second;
+			for(NodeList::const_iterator it = list.begin(); it != list.end(); ++it)
+			{
+				if(nodes[*it].GetColor() == PASSED) factory->Write(out, *nodes[*it].GetMarking());
+			}
+		}
+	}
+
+	void PWList::Load(BinaryReader& in)
+	{
+		assert(stats.storedStates == 0);
+		stats = in.Read<Stats>();
+
+		long long waiting = in.Read<long long>();
+		for(long long i = 0; i < waiting; i++)
+		{
+			StoredMarking* marking = factory->Read(in);
+			NodeIndex node = nodes.Allocate(marking, WAITING);
+			map[marking->HashKey()].push_back(node);
+			waitingList->Add(node);
+		}
+
+		long long passed = in.Read<long long>();
+		for(long long i = 0; i < passed; i++)
+		{
+			StoredMarking* marking = factory->Read(in);
+			map[marking->HashKey()].push_back(nodes.Allocate(marking, PASSED));
+		}
+	}
 }
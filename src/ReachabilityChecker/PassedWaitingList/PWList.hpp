@@ -4,26 +4,28 @@
 #include "google/sparse_hash_map"
 #include <list>
 #include "PassedWaitingList.hpp"
-#include "Node.hpp"
+#include "NodeStore.hpp"
 #include "../../Core/SymbolicMarking/DiscretePart.hpp"
 #include "WaitingList.hpp"
 
 namespace VerifyTAPN {
 	class SymbolicMarking;
-	class Node;
 	class MarkingFactory;
 
 	class PWList : public PassedWaitingList {
 	private:
-		typedef std::list<Node*> NodeList;
+		typedef std::list<NodeIndex> NodeList;
 		//typedef google::sparse_hash_map<const DiscretePart, NodeList, VerifyTAPN::hash, VerifyTAPN::eqdp > HashMap;
 		typedef google::sparse_hash_map<size_t, NodeList> HashMap; // TODO: Check if we need to explicitly change hash function to identity?
 	public:
-		PWList(WaitingList* waitingList, MarkingFactory* factory) : map(256000), stats(), waitingList(waitingList), factory(factory) {};
+		PWList(NodeStore& nodes, WaitingList* waitingList, MarkingFactory* factory, unsigned int maxExpanded)
+			: map(256000), stats(), nodes(nodes), waitingList(waitingList), factory(factory), maxExpanded(maxExpanded) {};
 		virtual ~PWList();
 
 	public: // inspectors
 		virtual bool HasWaitingStates() const;
+		virtual long long WaitingSize() const { return waitingList->Size(); };
+		virtual long long WaitingSizeIncludingCovered() const { return waitingList->SizeIncludingCovered(); };
 		virtual long long Size() const;
 		virtual Stats GetStats() const;
 
@@ -31,12 +33,20 @@ namespace VerifyTAPN {
 
 	public: // modifiers
 		virtual bool Add(const SymbolicMarking& symMarking);
+		virtual bool Add(SymbolicMarking* symMarking, bool& kept);
 		virtual SymbolicMarking* GetNextUnexplored();
+
+		virtual void Save(BinaryWriter& out) const;
+		virtual void Load(BinaryReader& in);
+	private:
+		NodeIndex Insert(const SymbolicMarking& symMarking);
 	private:
 		HashMap map;
 		Stats stats;
+		NodeStore& nodes;
 		WaitingList* waitingList;
 		MarkingFactory* factory;
+		unsigned int maxExpanded; // waiting nodes that may keep their marking in expanded form
 	};
 }
 
@@ -6,6 +6,8 @@
 namespace VerifyTAPN
 {
 	class SymbolicMarking;
+	class BinaryWriter;
+	class BinaryReader;
 
 	struct Stats{
 		long long exploredStates;
@@ -22,11 +24,19 @@ namespace VerifyTAPN
 
 		virtual long long Size() const = 0;
 		virtual bool HasWaitingStates() const = 0;
+		virtual long long WaitingSize() const = 0;
+		virtual long long WaitingSizeIncludingCovered() const = 0;
 
 		virtual bool Add(const SymbolicMarking& marking) = 0;
+		// Like Add, but the list may keep the marking itself for GetNextUnexplored. If it
+		// does, kept is set and the caller must not release the marking.
+		virtual bool Add(SymbolicMarking* marking, bool& kept) { kept = false; return Add(*marking); };
 		virtual SymbolicMarking* GetNextUnexplored() = 0;
 		virtual Stats GetStats() const = 0;
 		virtual void Print() const = 0;
+
+		virtual void Save(BinaryWriter& out) const = 0;
+		virtual void Load(BinaryReader& in) = 0;
 	};
 
 	inline std::ostream& operator<<(std::ostream& out, const Stats& stats)
@@ -2,83 +2,113 @@
 #define PRIORITYQUEUEWAITINGLIST_HPP_
 
 #include "WaitingList.hpp"
-#include <queue>
+#include <vector>
+#include <algorithm>
 #include "Node.hpp"
 
 namespace VerifyTAPN {
 
 	struct WeightedNode{
-		Node* node;
+		NodeIndex node;
 		int weight;
-		virtual ~WeightedNode() { if(node->GetColor() == COVERED) delete node; };
 	};
 
-	struct less : public std::binary_function<WeightedNode*, WeightedNode*, bool>
+	struct less : public std::binary_function<WeightedNode, WeightedNode, bool>
 	{
-		bool operator()(const WeightedNode* x, const WeightedNode* y) const
+		bool operator()(const WeightedNode& x, const WeightedNode& y) const
 		{
-			return x->weight < y->weight;
+			return x.weight < y.weight;
 		}
 	};
 
 	template <typename CalcWeight>
 	class PriorityQueueWaitingList : public VerifyTAPN::WaitingList {
 	public:
-		typedef std::priority_queue<WeightedNode*, std::vector<WeightedNode*>, less > priority_queue;
+		// The heap is kept in a plain vector (using std::push_heap/std::pop_heap)
+		// rather than a std::priority_queue, so covered nodes can be swept out in place.
+		typedef std::vector<WeightedNode> heap;
 	public:
-		PriorityQueueWaitingList(): calcWeight(), queue(), actualSize(0) { };
-		virtual ~PriorityQueueWaitingList()
-		{
-			while(!queue.empty())
-			{
-				WeightedNode* it = queue.top();
-				delete it;
-				queue.pop();
-			}
-		}
+		explicit PriorityQueueWaitingList(NodeStore& nodes): WaitingList(nodes), calcWeight(), queue(), actualSize(0) { };
+		PriorityQueueWaitingList(NodeStore& nodes, const CalcWeight& calcWeight): WaitingList(nodes), calcWeight(calcWeight), queue(), actualSize(0) { };
+		virtual ~PriorityQueueWaitingList() { };
 	public:
-		virtual void Add(Node* node);
-		virtual Node* Next();
+		virtual void Add(NodeIndex node);
+		virtual NodeIndex Next();
 		virtual long long Size() const { return actualSize; };
 		inline virtual long long SizeIncludingCovered() const { return queue.size(); };
-		inline virtual void DecrementActualSize() { actualSize--; };
+		inline virtual void DecrementActualSize() { actualSize--; if(ShouldCompact(actualSize)) Compact(); };
+		virtual void CollectWaitingNodes(std::vector<NodeIndex>& waiting) const;
+	private:
+		void Compact();
 
 	private:
 		CalcWeight calcWeight;
-		priority_queue queue;
+		heap queue;
 		long long actualSize;
 	};
 
 	template <typename CalcWeight>
-		void PriorityQueueWaitingList<CalcWeight>::Add(Node* node)
+		void PriorityQueueWaitingList<CalcWeight>::Add(NodeIndex node)
 		{
-			if(node){
-				assert(node->GetColor()==WAITING);
-				WeightedNode* wnode = new WeightedNode;
-				wnode->node = node;
-				wnode->weight = calcWeight(node);
-				queue.push(wnode);
+			if(node != NodeStore::NO_NODE){
+				assert(nodes[node].GetColor()==WAITING);
+				WeightedNode wnode;
+				wnode.node = node;
+				wnode.weight = calcWeight(nodes[node]);
+				queue.push_back(wnode);
+				std::push_heap(queue.begin(), queue.end(), less());
 				actualSize++;
 			}
 		}
 
 		template <typename CalcWeight>
-		Node* PriorityQueueWaitingList<CalcWeight>::Next()
+		NodeIndex PriorityQueueWaitingList<CalcWeight>::Next()
 		{
-			if(Size() == 0) return NULL;
-			WeightedNode* node = queue.top();
-			assert(node->node->GetColor() == WAITING || node->node->GetColor() == COVERED);
-			while(node->node->GetColor() == COVERED){
-				queue.pop();
-				delete node;
-				node = queue.top();
-				if(node == NULL || node->node == NULL) return NULL;
+			if(Size() == 0) return NodeStore::NO_NODE;
+			NodeIndex node = queue.front().node;
+			assert(nodes[node].GetColor() == WAITING || nodes[node].GetColor() == COVERED);
+			while(nodes[node].GetColor() == COVERED){
+				std::pop_heap(queue.begin(), queue.end(), less());
+				queue.pop_back();
+				nodes.Free(node);
+				if(queue.empty()) return NodeStore::NO_NODE;
+				node = queue.front().node;
 			}
 
-			queue.pop(); actualSize--;
-			node->node->Recolor(PASSED);
-	//		assert(AllElementsAreWatingOrCovered(stack.begin(), stack.end()));
-			return node->node;
+			std::pop_heap(queue.begin(), queue.end(), less());
+			queue.pop_back(); actualSize--;
+			nodes[node].Recolor(PASSED);
+			return node;
+		}
+
+		template <typename CalcWeight>
+		void PriorityQueueWaitingList<CalcWeight>::CollectWaitingNodes(std::vector<NodeIndex>& waiting) const
+		{
+			for(typename heap::const_iterator it = queue.begin(); it != queue.end(); it++)
+			{
+				if(nodes[it->node].GetColor() == WAITING) waiting.push_back(it->node);
+			}
+		}
+
+		template <typename CalcWeight>
+		void PriorityQueueWaitingList<CalcWeight>::Compact()
+		{
+			typename heap::iterator dest = queue.begin();
+			for(typename heap::iterator it = queue.begin(); it != queue.end(); it++)
+			{
+				if(nodes[it->node].GetColor() == COVERED)
+				{
+					nodes.Free(it->node);
+				}
+				else
+				{
+					*dest = *it;
+					dest++;
+				}
+			}
+			queue.erase(dest, queue.end());
+			std::make_heap(queue.begin(), queue.end(), less());
+			assert(queue.size() == static_cast<size_t>(actualSize));
 		}
 }
 
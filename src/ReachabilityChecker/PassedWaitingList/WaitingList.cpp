@@ -5,12 +5,12 @@
 namespace VerifyTAPN
 {
 	template<class InputIterator>
-	bool AllElementsAreWatingOrCovered ( InputIterator first, InputIterator last )
+	bool AllElementsAreWatingOrCovered ( const NodeStore& nodes, InputIterator first, InputIterator last )
 	{
 		for ( ;first!=last; first++)
 		{
-			Node* node = *first;
-			if ( node->GetColor() != WAITING && node->GetColor() != COVERED )
+			const Node& node = nodes[*first];
+			if ( node.GetColor() != WAITING && node.GetColor() != COVERED )
 			{
 				return false;
 			}
@@ -19,12 +19,11 @@ namespace VerifyTAPN
 	}
 
 	template<class InputIterator>
-		bool AllElementsAreCovered ( InputIterator first, InputIterator last )
+		bool AllElementsAreCovered ( const NodeStore& nodes, InputIterator first, InputIterator last )
 		{
 			for ( ;first!=last; first++)
 			{
-				Node* node = *first;
-				if ( node->GetColor() != COVERED )
+				if ( nodes[*first].GetColor() != COVERED )
 				{
 					return false;
 				}
@@ -33,28 +32,58 @@ namespace VerifyTAPN
 		}
 
 
-	void QueueWaitingList::Add(Node* node)
+	// Frees all covered nodes in the container and moves the remaining
+	// nodes to the front, preserving their relative order.
+	template<class Container>
+	void RemoveCoveredNodes(NodeStore& nodes, Container& container)
 	{
-		if(node){
+		typename Container::iterator dest = container.begin();
+		for(typename Container::iterator it = container.begin(); it != container.end(); it++)
+		{
+			if(nodes[*it].GetColor() == COVERED)
+			{
+				nodes.Free(*it);
+			}
+			else
+			{
+				*dest = *it;
+				dest++;
+			}
+		}
+		container.erase(dest, container.end());
+	}
+
+	template<class InputIterator>
+	void CopyWaitingNodes(const NodeStore& nodes, InputIterator first, InputIterator last, std::vector<NodeIndex>& waiting)
+	{
+		for ( ;first!=last; first++)
+		{
+			if(nodes[*first].GetColor() == WAITING) waiting.push_back(*first);
+		}
+	}
+
+	void QueueWaitingList::Add(NodeIndex node)
+	{
+		if(node != NodeStore::NO_NODE){
 			queue.push_back(node);
 			actualSize++;
 		}
 	}
 
-	Node* QueueWaitingList::Next()
+	NodeIndex QueueWaitingList::Next()
 	{
-		if(Size() == 0) return NULL;
-		Node* node = queue.front();
-		assert(node->GetColor() == WAITING || node->GetColor() == COVERED);
-		while(node->GetColor() == COVERED){
+		if(Size() == 0) return NodeStore::NO_NODE;
+		NodeIndex node = queue.front();
+		assert(nodes[node].GetColor() == WAITING || nodes[node].GetColor() == COVERED);
+		while(nodes[node].GetColor() == COVERED){
 			queue.pop_front();
-			delete node;
+			nodes.Free(node);
+			if(queue.empty()) return NodeStore::NO_NODE;
 			node = queue.front();
-			if(node == NULL) return NULL;
 		}
 
 		queue.pop_front(); actualSize--;
-		node->Recolor(PASSED);
+		nodes[node].Recolor(PASSED);
 		return node;
 	}
 
@@ -63,30 +92,41 @@ namespace VerifyTAPN
 		return actualSize;
 	}
 
-	void StackWaitingList::Add(Node* node)
+	void QueueWaitingList::Compact()
+	{
+		RemoveCoveredNodes(nodes, queue);
+		assert(queue.size() == static_cast<size_t>(actualSize));
+	}
+
+	void QueueWaitingList::CollectWaitingNodes(std::vector<NodeIndex>& waiting) const
+	{
+		CopyWaitingNodes(nodes, queue.begin(), queue.end(), waiting);
+	}
+
+	void StackWaitingList::Add(NodeIndex node)
 	{
-		if(node){
-			assert(node->GetColor()==WAITING);
+		if(node != NodeStore::NO_NODE){
+			assert(nodes[node].GetColor()==WAITING);
 			stack.push_back(node);
 			actualSize++;
 		}
 	}
 
-	Node* StackWaitingList::Next()
+	NodeIndex StackWaitingList::Next()
 	{
-		if(Size() == 0) return NULL;
-		Node* node = stack.back();
-		assert(node->GetColor() == WAITING || node->GetColor() == COVERED);
-		while(node->GetColor() == COVERED){
+		if(Size() == 0) return NodeStore::NO_NODE;
+		NodeIndex node = stack.back();
+		assert(nodes[node].GetColor() == WAITING || nodes[node].GetColor() == COVERED);
+		while(nodes[node].GetColor() == COVERED){
 			stack.pop_back();
-			delete node;
+			nodes.Free(node);
+			if(stack.empty()) return NodeStore::NO_NODE;
 			node = stack.back();
-			if(node == NULL) return NULL;
 		}
 
 		stack.pop_back(); actualSize--;
-		node->Recolor(PASSED);
-//		assert(AllElementsAreWatingOrCovered(stack.begin(), stack.end()));
+		nodes[node].Recolor(PASSED);
+//		assert(AllElementsAreWatingOrCovered(nodes, stack.begin(), stack.end()));
 		return node;
 	}
 
@@ -95,23 +135,14 @@ namespace VerifyTAPN
 		return actualSize;
 	}
 
-	QueueWaitingList::~QueueWaitingList()
+	void StackWaitingList::Compact()
 	{
-		for(std::deque<Node*>::iterator it = queue.begin(); it != queue.end(); it++)
-		{
-			if((*it)->GetColor() == COVERED){
-				delete *it;
-			}
-		}
+		RemoveCoveredNodes(nodes, stack);
+		assert(stack.size() == static_cast<size_t>(actualSize));
 	}
 
-	StackWaitingList::~StackWaitingList()
+	void StackWaitingList::CollectWaitingNodes(std::vector<NodeIndex>& waiting) const
 	{
-		for(std::deque<Node*>::iterator it = stack.begin(); it != stack.end(); it++)
-		{
-			if((*it)->GetColor() == COVERED){
-				delete *it;
-			}
-		}
+		CopyWaitingNodes(nodes, stack.begin(), stack.end(), waiting);
 	}
 }
@@ -3,49 +3,73 @@
 
 #include <queue>
 #include <deque>
+#include <vector>
+#include "NodeStore.hpp"
 
 namespace VerifyTAPN{
-	class Node;
-
+	// Waiting lists hold indices into the node store. Covered nodes are freed in
+	// the store once they leave the list.
 	class WaitingList {
 	public:
-		WaitingList() { };
+		explicit WaitingList(NodeStore& nodes) : nodes(nodes) { };
 		virtual ~WaitingList() { };
-		virtual void Add(Node* node) = 0;
-		virtual Node* Next() = 0;
+		virtual void Add(NodeIndex node) = 0;
+		virtual NodeIndex Next() = 0;
 		virtual long long Size() const = 0;
 		virtual long long SizeIncludingCovered() const = 0;
 		virtual void DecrementActualSize() = 0;
+		// Appends the waiting (non-covered) nodes in an order such that adding them
+		// one by one to an empty list of the same kind restores this list.
+		virtual void CollectWaitingNodes(std::vector<NodeIndex>& waiting) const = 0;
+	protected:
+		// Covered nodes are only dropped lazily when they reach the front of the list.
+		// Once they outnumber the waiting nodes (and there are enough of them to make
+		// a sweep worthwhile) they are removed in one pass, keeping the order of the rest.
+		inline bool ShouldCompact(long long actualSize) const
+		{
+			long long covered = SizeIncludingCovered() - actualSize;
+			return covered >= MIN_COVERED_BEFORE_COMPACTION && covered > actualSize;
+		};
+	private:
+		static const long long MIN_COVERED_BEFORE_COMPACTION = 1024;
+	protected:
+		NodeStore& nodes;
 	};
 
 	class QueueWaitingList : public WaitingList{
 	public:
-		QueueWaitingList() : queue(), actualSize(0) { };
-		virtual ~QueueWaitingList();
+		explicit QueueWaitingList(NodeStore& nodes) : WaitingList(nodes), queue(), actualSize(0) { };
+		virtual ~QueueWaitingList() { };
 	public:
-		virtual void Add(Node* node);
-		virtual Node* Next();
+		virtual void Add(NodeIndex node);
+		virtual NodeIndex Next();
 		virtual long long Size() const;
 	public:
-		inline virtual void DecrementActualSize() { actualSize--; };
+		inline virtual void DecrementActualSize() { actualSize--; if(ShouldCompact(actualSize)) Compact(); };
 		inline virtual long long SizeIncludingCovered() const { return queue.size(); };
+		virtual void CollectWaitingNodes(std::vector<NodeIndex>& waiting) const;
 	private:
-		std::deque<Node*> queue;
+		void Compact();
+	private:
+		std::deque<NodeIndex> queue;
 		long long actualSize;
 	};
 
 	class StackWaitingList : public WaitingList{
 		public:
-		StackWaitingList() : stack(), actualSize(0) { };
-		virtual ~StackWaitingList();
+		explicit StackWaitingList(NodeStore& nodes) : WaitingList(nodes), stack(), actualSize(0) { };
+		virtual ~StackWaitingList() { };
 		public:
-			virtual void Add(Node* node);
-			virtual Node* Next();
+			virtual void Add(NodeIndex node);
+			virtual NodeIndex Next();
 			virtual long long Size() const;
 			inline virtual long long SizeIncludingCovered() const { return stack.size(); };
-			inline virtual void DecrementActualSize() { actualSize--; };
+			inline virtual void DecrementActualSize() { actualSize--; if(ShouldCompact(actualSize)) Compact(); };
+			virtual void CollectWaitingNodes(std::vector<NodeIndex>& waiting) const;
+		private:
+			void Compact();
 		private:
-			std::deque<Node*> stack;
+			std::deque<NodeIndex> stack;
 			long long actualSize;
 		};
 
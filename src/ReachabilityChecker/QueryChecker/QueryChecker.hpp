@@ -2,6 +2,7 @@
 #define QUERYCHECKER_HPP_
 
 #include "../../Core/QueryParser/AST.hpp"
+#include "QueryProgram.hpp"
 
 namespace VerifyTAPN
 {
@@ -16,9 +17,11 @@ namespace VerifyTAPN
 		bool IsExpressionSatisfied(const SymbolicMarking& marking) const;
 		inline bool IsEF() const { return query->GetQuantifier() == VerifyTAPN::AST::EF; };
 		inline bool IsAG() const { return query->GetQuantifier() == VerifyTAPN::AST::AG; };
+		inline const AST::Query& GetQuery() const { return *query; };
 
 	private:
 		const AST::Query* query;
+		QueryProgram program;
 	};
 }
 
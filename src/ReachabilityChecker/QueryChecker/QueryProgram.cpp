@@ -0,0 +1,177 @@
+#include "QueryProgram.hpp"
+#include "../../Core/SymbolicMarking/SymbolicMarking.hpp"
+#include <algorithm>
+#include <exception>
+#include "assert.h"
+
+namespace VerifyTAPN
+{
+	QueryProgram::QueryProgram(const AST::Query& query) : program(), places(), counts(), stack()
+	{
+		QueryCompiler compiler(*this);
+		compiler.Compile(query);
+		counts.resize(places.size());
+	}
+
+	bool QueryProgram::Evaluate(const SymbolicMarking& marking) const
+	{
+		for(unsigned int slot = 0; slot < places.size(); slot++)
+		{
+			counts[slot] = marking.NumberOfTokensInPlace(places[slot]);
+		}
+		return Run();
+	}
+
+	bool QueryProgram::Evaluate(const std::vector<int>& tokens) const
+	{
+		for(unsigned int slot = 0; slot < places.size(); slot++)
+		{
+			counts[slot] = static_cast<unsigned int>(places[slot]) < tokens.size() ? tokens[places[slot]] : 0;
+		}
+		return Run();
+	}
+
+	bool QueryProgram::Run() const
+	{
+		int* top = &stack[0]; // one past the topmost value
+		for(std::vector<Instruction>::const_iterator pc = program.begin(); pc != program.end(); ++pc)
+		{
+			switch(pc->op)
+			{
+			case PUSH_CONSTANT: *top++ = pc->arg; break;
+			case PUSH_PLACE: *top++ = counts[pc->arg]; break;
+			case ADD: top--; top[-1] = top[-1] + top[0]; break;
+			case SUBTRACT: top--; top[-1] = top[-1] - top[0]; break;
+			case MULTIPLY: top--; top[-1] = top[-1] * top[0]; break;
+			case NEGATE: top[-1] = -top[-1]; break;
+			case LESS: top--; top[-1] = top[-1] < top[0]; break;
+			case LESS_EQUAL: top--; top[-1] = top[-1] <= top[0]; break;
+			case EQUAL: top--; top[-1] = top[-1] == top[0]; break;
+			case GREATER_EQUAL: top--; top[-1] = top[-1] >= top[0]; break;
+			case GREATER: top--; top[-1] = top[-1] > top[0]; break;
+			case NOT_EQUAL: top--; top[-1] = top[-1] != top[0]; break;
+			case NOT: top[-1] = !top[-1]; break;
+			case JUMP_IF_FALSE_OR_POP:
+				if(!top[-1]) pc = program.begin() + pc->arg - 1;
+				else top--;
+				break;
+			case JUMP_IF_TRUE_OR_POP:
+				if(top[-1]) pc = program.begin() + pc->arg - 1;
+				else top--;
+				break;
+			}
+		}
+		assert(top == &stack[0] + 1);
+		return stack[0] != 0;
+	}
+
+	void QueryCompiler::Compile(const AST::Query& query)
+	{
+		boost::any any;
+		query.Accept(*this, any);
+		assert(depth == 1);
+		program.stack.resize(maxDepth);
+	}
+
+	void QueryCompiler::Emit(QueryProgram::OpCode op, int arg, int pushed, int popped)
+	{
+		program.program.push_back(QueryProgram::Instruction(op, arg));
+		depth += pushed - popped;
+		maxDepth = std::max(maxDepth, depth);
+	}
+
+	// The left value is left on the stack as the result if it decides the junction,
+	// otherwise it is popped and the right operand is evaluated in its place.
+	void QueryCompiler::EmitJunction(QueryProgram::OpCode jump, const AST::Expression& left, const AST::Expression& right, boost::any& context)
+	{
+		left.Accept(*this, context);
+		size_t branch = program.program.size();
+		Emit(jump, 0, 0, 1);
+		right.Accept(*this, context);
+		program.program[branch].arg = program.program.size();
+	}
+
+	void QueryCompiler::EmitBinary(QueryProgram::OpCode op, const AST::ArithmeticExpression& left, const AST::ArithmeticExpression& right, boost::any& context)
+	{
+		left.Accept(*this, context);
+		right.Accept(*this, context);
+		Emit(op, 0, 1, 2);
+	}
+
+	QueryProgram::OpCode QueryCompiler::Comparison(const std::string& op)
+	{
+		if(op == "<") return QueryProgram::LESS;
+		else if(op == "<=") return QueryProgram::LESS_EQUAL;
+		else if(op == "=" || op == "==") return QueryProgram::EQUAL;
+		else if(op == ">=") return QueryProgram::GREATER_EQUAL;
+		else if(op == ">") return QueryProgram::GREATER;
+		else if(op == "!=") return QueryProgram::NOT_EQUAL;
+		else
+			throw std::exception();
+	}
+
+	void QueryCompiler::Visit(const AST::NotExpression& expr, boost::any& context)
+	{
+		expr.Child().Accept(*this, context);
+		Emit(QueryProgram::NOT, 0, 1, 1);
+	}
+
+	void QueryCompiler::Visit(const AST::OrExpression& expr, boost::any& context)
+	{
+		EmitJunction(QueryProgram::JUMP_IF_TRUE_OR_POP, expr.Left(), expr.Right(), context);
+	}
+
+	void QueryCompiler::Visit(const AST::AndExpression& expr, boost::any& context)
+	{
+		EmitJunction(QueryProgram::JUMP_IF_FALSE_OR_POP, expr.Left(), expr.Right(), context);
+	}
+
+	void QueryCompiler::Visit(const AST::AtomicProposition& expr, boost::any& context)
+	{
+		EmitBinary(Comparison(expr.Operator()), expr.GetLeft(), expr.GetRight(), context);
+	}
+
+	void QueryCompiler::Visit(const AST::BoolExpression& expr, boost::any& context)
+	{
+		Emit(QueryProgram::PUSH_CONSTANT, expr.GetValue() ? 1 : 0, 1, 0);
+	}
+
+	void QueryCompiler::Visit(const AST::Query& query, boost::any& context)
+	{
+		query.Child().Accept(*this, context);
+	}
+
+	void QueryCompiler::Visit(const AST::NumberExpression& expr, boost::any& context)
+	{
+		Emit(QueryProgram::PUSH_CONSTANT, expr.GetValue(), 1, 0);
+	}
+
+	void QueryCompiler::Visit(const AST::IdentifierExpression& expr, boost::any& context)
+	{
+		std::vector<int>& places = program.places;
+		int slot = std::find(places.begin(), places.end(), expr.GetPlace()) - places.begin();
+		if(slot == static_cast<int>(places.size())) places.push_back(expr.GetPlace());
+		Emit(QueryProgram::PUSH_PLACE, slot, 1, 0);
+	}
+
+	void QueryCompiler::Visit(const AST::MultiplyExpression& expr, boost::any& context)
+	{
+		EmitBinary(QueryProgram::MULTIPLY, expr.GetLeft(), expr.GetRight(), context);
+	}
+
+	void QueryCompiler::Visit(const AST::MinusExpression& expr, boost::any& context)
+	{
+		expr.GetValue().Accept(*this, context);
+		Emit(QueryProgram::NEGATE, 0, 1, 1);
+	}
+
+	void QueryCompiler::Visit(const AST::SubtractExpression& expr, boost::any& context)
+	{
+		EmitBinary(QueryProgram::SUBTRACT, expr.GetLeft(), expr.GetRight(), context);
+	}
+
+	void QueryCompiler::Visit(const AST::PlusExpression& expr, boost::any& context)
+	{
+		EmitBinary(QueryProgram::ADD, expr.GetLeft(), expr.GetRight(), context);
+	}
+}
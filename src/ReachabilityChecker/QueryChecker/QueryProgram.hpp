@@ -0,0 +1,91 @@
+#ifndef QUERYPROGRAM_HPP_
+#define QUERYPROGRAM_HPP_
+
+#include <vector>
+#include <string>
+#include "../../Core/QueryParser/AST.hpp"
+
+namespace VerifyTAPN
+{
+	class SymbolicMarking;
+
+	// A query expression lowered to a program for a small stack machine working on
+	// ints (truth values are 0 and 1). The token counts of the places mentioned in
+	// the query are fetched once before the program runs, and evaluation does not
+	// allocate. And and Or are short-circuited.
+	class QueryProgram
+	{
+	public:
+		enum OpCode {
+			PUSH_CONSTANT, PUSH_PLACE, // arg: the constant, or the slot of the place
+			ADD, SUBTRACT, MULTIPLY, NEGATE,
+			LESS, LESS_EQUAL, EQUAL, GREATER_EQUAL, GREATER, NOT_EQUAL,
+			NOT,
+			JUMP_IF_FALSE_OR_POP, JUMP_IF_TRUE_OR_POP // arg: the target; pops unless it jumps
+		};
+
+		struct Instruction {
+			OpCode op;
+			int arg;
+
+			Instruction(OpCode op, int arg) : op(op), arg(arg) { };
+		};
+
+	public:
+		explicit QueryProgram(const AST::Query& query);
+
+		bool Evaluate(const SymbolicMarking& marking) const;
+		bool Evaluate(const std::vector<int>& tokens) const; // tokens[p]: the number of tokens in place p
+
+		inline const std::vector<Instruction>& Instructions() const { return program; };
+		inline const std::vector<int>& Places() const { return places; };
+
+	private:
+		bool Run() const;
+
+	private:
+		std::vector<Instruction> program;
+		std::vector<int> places; // the place read by each slot
+
+		mutable std::vector<int> counts; // scratch space for Evaluate
+		mutable std::vector<int> stack;
+
+		friend class QueryCompiler;
+	};
+
+	class QueryCompiler : public AST::Visitor
+	{
+	public:
+		explicit QueryCompiler(QueryProgram& program) : program(program), depth(0), maxDepth(0) { };
+		virtual ~QueryCompiler() { };
+
+		void Compile(const AST::Query& query);
+
+	public: // visitor methods
+		virtual void Visit(const AST::NotExpression& expr, boost::any& context);
+		virtual void Visit(const AST::OrExpression& expr, boost::any& context);
+		virtual void Visit(const AST::AndExpression& expr, boost::any& context);
+		virtual void Visit(const AST::AtomicProposition& expr, boost::any& context);
+		virtual void Visit(const AST::BoolExpression& expr, boost::any& context);
+		virtual void Visit(const AST::Query& query, boost::any& context);
+		virtual void Visit(const AST::NumberExpression& expr, boost::any& context);
+		virtual void Visit(const AST::IdentifierExpression& expr, boost::any& context);
+		virtual void Visit(const AST::MultiplyExpression& expr, boost::any& context);
+		virtual void Visit(const AST::MinusExpression& expr, boost::any& context);
+		virtual void Visit(const AST::SubtractExpression& expr, boost::any& context);
+		virtual void Visit(const AST::PlusExpression& expr, boost::any& context);
+
+	private:
+		void Emit(QueryProgram::OpCode op, int arg, int pushed, int popped);
+		void EmitJunction(QueryProgram::OpCode jump, const AST::Expression& left, const AST::Expression& right, boost::any& context);
+		void EmitBinary(QueryProgram::OpCode op, const AST::ArithmeticExpression& left, const AST::ArithmeticExpression& right, boost::any& context);
+		static QueryProgram::OpCode Comparison(const std::string& op);
+
+	private:
+		QueryProgram& program;
+		int depth;
+		int maxDepth;
+	};
+}
+
+#endif /* QUERYPROGRAM_HPP_ */
@@ -2,24 +2,18 @@
 #define COVERMOSTSEARCH_HPP_
 
 #include "SearchStrategy.hpp"
-#include "../PassedWaitingList/PriorityQueueWaitingList.hpp"
+#include "../PassedWaitingList/BucketWaitingList.hpp"
 #include "../PassedWaitingList/Node.hpp"
 #include "../../Core/SymbolicMarking/DiscretePartInclusionMarking.hpp"
 
 namespace VerifyTAPN
 {
-	struct CalcWeight : public std::unary_function<Node*, int>
+	struct CalcWeight : public std::unary_function<Node, int>
 	{
-		int operator()(const Node* node) const
+		int operator()(const Node& node) const
 		{
-			int weight = 0;
-			const DiscretePartInclusionMarking& other = static_cast<const DiscretePartInclusionMarking&>(*node->GetMarking());
-			const std::vector<int>& inc = other.inclusionTokens();
-			for(std::vector<int>::const_iterator it = inc.begin(); it != inc.end(); it++)
-			{
-				weight += *it;
-			}
-			return weight;
+			const DiscretePartInclusionMarking& other = static_cast<const DiscretePartInclusionMarking&>(*node.GetMarking());
+			return other.NumberOfInclusionTokens();
 		}
 	};
 
@@ -35,7 +29,7 @@ namespace VerifyTAPN
 		) : DefaultSearchStrategy(tapn, initialMarking, query, options, factory) { };
 
 	protected:
-		virtual WaitingList* CreateWaitingList() const { return new PriorityQueueWaitingList<CalcWeight>; };
+		virtual WaitingList* CreateWaitingList(NodeStore& nodes) const { return new BucketWaitingList<CalcWeight>(nodes); };
 	};
 
 }
@@ -17,7 +17,7 @@ namespace VerifyTAPN
 		) : DefaultSearchStrategy(tapn, initialMarking, query, options, factory) { };
 
 	protected:
-		virtual WaitingList* CreateWaitingList() const { return new StackWaitingList; };
+		virtual WaitingList* CreateWaitingList(NodeStore& nodes) const { return new StackWaitingList(nodes); };
 	};
 
 }
@@ -0,0 +1,265 @@
+#include "LivenessSearch.hpp"
+#include "../../Core/TAPN/TimedArcPetriNet.hpp"
+#include "../../Core/Profiler.hpp"
+#include <limits>
+
+namespace VerifyTAPN
+{
+	LivenessSearch::LivenessSearch(
+		const VerifyTAPN::TAPN::TimedArcPetriNet& tapn,
+		SymbolicMarking* initialMarking,
+		const AST::Query* query,
+		const VerificationOptions& options,
+		MarkingFactory* factory
+	) : nodes(), map(256000), stack(), stats(), tapn(tapn), initialMarking(initialMarking), checker(query), results(1), options(options), succGen(tapn, *factory, options, initialMarking->NumberOfTokens()), factory(factory)
+	{
+		maxConstantsArray = new int[options.GetKBound()+1];
+		for(unsigned int i = 0; i < options.GetKBound()+1; ++i)
+		{
+			maxConstantsArray[i] = tapn.MaxConstant();
+		}
+	}
+
+	LivenessSearch::~LivenessSearch()
+	{
+		// a witness ends the search with successors left on the stack
+		for(std::vector<Frame>::iterator frame = stack.begin(); frame != stack.end(); ++frame)
+		{
+			for(unsigned int i = frame->next; i < frame->successors.size(); i++)
+				factory->Release(frame->successors[i].Marking());
+			factory->Release(frame->marking);
+		}
+		delete[] maxConstantsArray;
+	}
+
+	// A liveness query is always verified on its own.
+	void LivenessSearch::AddQuery(const AST::Query* query)
+	{
+		throw std::string("Verifying several queries at once is not supported for EG and AF queries.");
+	}
+
+	bool LivenessSearch::Verify()
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		bool found = FindMaximalRun();
+
+		QueryResult& result = results[0];
+		result.decided = true;
+		result.satisfied = checker.GetQuery().GetQuantifier() == AST::EG ? found : !found;
+		result.stats = stats;
+		result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		return result.satisfied;
+	}
+
+	// Searches for a maximal run through markings satisfying the proposition of an
+	// EG query, or violating that of an AF query.
+	bool LivenessSearch::FindMaximalRun()
+	{
+		Prepare(*initialMarking);
+		if(!Satisfies(*initialMarking))
+		{
+			factory->Release(initialMarking);
+			return false;
+		}
+
+		bool onStack;
+		if(Expand(initialMarking, Insert(*initialMarking, onStack))) return true;
+
+		while(!stack.empty())
+		{
+			Frame& frame = stack.back();
+			if(frame.next == frame.successors.size())
+			{
+				if(frame.transition < tapn.GetNumberOfTransitions())
+				{
+					FireNextTransition(frame);
+					continue;
+				}
+
+				// a maximal run can end in a marking without successors or in a time-lock
+				if((!frame.fired && !frame.cut) || CanTimeLock(*frame.marking)) return true;
+				nodes[frame.node].Recolor(PASSED);
+				factory->Release(frame.marking);
+				stack.pop_back();
+				continue;
+			}
+
+			const Successor& successor = frame.successors[frame.next++];
+			SymbolicMarking* next = successor.Marking();
+			Prepare(*next);
+			if(!Satisfies(*next))
+			{
+				factory->Release(next);
+				continue;
+			}
+
+			NodeIndex node;
+			{
+				PROFILE_SCOPE(PWLIST_ADD);
+				node = Insert(*next, onStack);
+			}
+			succGen.RecordSuccessorAdded(successor.TransitionIndex(), node != NodeStore::NO_NODE);
+			if(node == NodeStore::NO_NODE)
+			{
+				factory->Release(next);
+				if(onStack) return true; // closes a cycle
+				continue;
+			}
+
+			if(Expand(next, node)) return true;
+		}
+		return false;
+	}
+
+	void LivenessSearch::Prepare(SymbolicMarking& marking)
+	{
+		{
+			PROFILE_SCOPE(DELAY);
+			marking.Delay();
+		}
+		{
+			PROFILE_SCOPE(EXTRAPOLATE);
+			UpdateMaxConstantsArray(tapn, options, marking, maxConstantsArray);
+			marking.Extrapolate(maxConstantsArray);
+		}
+		if(options.GetSymmetryEnabled())
+		{
+			PROFILE_SCOPE(MAKE_SYMMETRIC);
+			BiMap bimap;
+			marking.MakeSymmetric(bimap);
+		}
+	}
+
+	bool LivenessSearch::Satisfies(const SymbolicMarking& marking) const
+	{
+		PROFILE_SCOPE(QUERY_CHECK);
+		return checker.IsExpressionSatisfied(marking) == (checker.GetQuery().GetQuantifier() == AST::EG);
+	}
+
+	bool LivenessSearch::CanDelayForever(const SymbolicMarking& marking) const
+	{
+		for(unsigned int i = 0; i < marking.NumberOfTokens(); i++)
+		{
+			if(tapn.GetPlace(marking.GetTokenPlacement(i)).GetInvariant() != TAPN::TimeInvariant::LS_INF) return false;
+		}
+		return true;
+	}
+
+	// Stores the marking unless it includes a marking on the stack, which closes a
+	// cycle, or is included in an explored marking. In both cases NO_NODE is
+	// returned and onStack tells which. Explored markings included in the new one
+	// are removed.
+	NodeIndex LivenessSearch::Insert(const SymbolicMarking& marking, bool& onStack)
+	{
+		StoredMarking* storedMarking;
+		{
+			PROFILE_SCOPE(CONVERT);
+			storedMarking = factory->Convert(const_cast<SymbolicMarking*>(&marking));
+		}
+		stats.discoveredStates++;
+		NodeList& markings = map[storedMarking->HashKey()];
+		NodeList::iterator iter = markings.begin();
+		bool explored = false;
+		while(iter != markings.end())
+		{
+			Node& currentNode = nodes[*iter];
+			relation relation = storedMarking->Relation(*currentNode.GetMarking());
+			if(currentNode.GetColor() == WAITING)
+			{
+				// only including a stack marking closes a cycle, being included in it does not
+				if((relation & SUPERSET) != 0)
+				{
+					factory->Release(storedMarking);
+					onStack = true;
+					return NodeStore::NO_NODE;
+				}
+			}
+			else if((relation & SUBSET) != 0)
+			{
+				explored = true;
+			}
+			else if(relation == SUPERSET)
+			{
+				nodes.Free(*iter);
+				iter = markings.erase(iter);
+				stats.storedStates--;
+				continue;
+			}
+			iter++;
+		}
+
+		if(explored)
+		{
+			factory->Release(storedMarking);
+			onStack = false;
+			return NodeStore::NO_NODE;
+		}
+
+		stats.storedStates++;
+		NodeIndex node = nodes.Allocate(storedMarking, WAITING);
+		markings.push_back(node);
+		return node;
+	}
+
+	// Pushes the marking on the stack. Returns true if a maximal run can end in the
+	// marking by delaying forever; the other ways to end a run are checked once all
+	// transitions have been fired.
+	bool LivenessSearch::Expand(SymbolicMarking* marking, NodeIndex node)
+	{
+		stats.exploredStates++;
+		if(CanDelayForever(*marking))
+		{
+			factory->Release(marking);
+			return true;
+		}
+		stack.push_back(Frame(node, marking));
+		return false;
+	}
+
+	void LivenessSearch::FireNextTransition(Frame& frame)
+	{
+		PROFILE_SCOPE(SUCCESSOR_GENERATION);
+		frame.successors.clear();
+		frame.next = 0;
+		succGen.GenerateTransitionSuccessors(*frame.marking, frame.transition++, frame.successors);
+		frame.fired = frame.fired || !frame.successors.empty();
+		frame.cut = frame.cut || succGen.CutByKBound();
+	}
+
+	// A run time-locks when a token reaches the bound of its invariant while no
+	// transition is enabled. Nets with strict invariants are rejected up front, as
+	// their bound is never reached.
+	bool LivenessSearch::CanTimeLock(const SymbolicMarking& marking)
+	{
+		std::vector<SymbolicMarking*> enablingZones;
+		{
+			PROFILE_SCOPE(SUCCESSOR_GENERATION);
+			succGen.GenerateEnablingZones(marking, enablingZones);
+		}
+
+		bool timeLock = false;
+		for(unsigned int i = 0; !timeLock && i < marking.NumberOfTokens(); i++)
+		{
+			const TAPN::TimeInvariant& invariant = tapn.GetPlace(marking.GetTokenPlacement(i)).GetInvariant();
+			if(invariant == TAPN::TimeInvariant::LS_INF) continue;
+			assert(!invariant.IsBoundStrict());
+
+			SymbolicMarking* atBound = factory->Clone(marking);
+			atBound->Constrain(i, TAPN::TimeInterval(false, invariant.GetBound(), std::numeric_limits<int>::max(), true));
+			timeLock = !atBound->IsEmpty() && !atBound->IsCoveredBy(enablingZones);
+			factory->Release(atBound);
+		}
+
+		for(std::vector<SymbolicMarking*>::iterator iter = enablingZones.begin(); iter != enablingZones.end(); ++iter)
+			factory->Release(*iter);
+		return timeLock;
+	}
+
+	void LivenessSearch::PrintTransitionStatistics() const {
+		succGen.PrintTransitionStatistics(std::cout);
+	}
+
+	void LivenessSearch::ExportTransitionStatistics(std::ostream& out, StatisticsFormat format) const {
+		succGen.ExportTransitionStatistics(out, format);
+	}
+}
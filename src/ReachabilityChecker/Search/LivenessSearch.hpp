@@ -0,0 +1,90 @@
+#ifndef LIVENESSSEARCH_HPP_
+#define LIVENESSSEARCH_HPP_
+
+#include "SearchStrategy.hpp"
+#include "google/sparse_hash_map"
+#include <list>
+
+namespace VerifyTAPN
+{
+	// Verifies EG and AF queries. EG p holds if some maximal run stays in markings
+	// satisfying p, and AF p is checked as the negation of EG !p. A maximal run is
+	// either infinite, or ends in a marking that can delay forever (no token sits in
+	// a place with an invariant), in a symbolic marking without discrete successors,
+	// or in a time-lock where an invariant stops time and nothing is enabled.
+	// Like the reachability search, infinite runs are not required to be time
+	// divergent, and markings beyond the k-bound are not explored.
+	//
+	// The search is a single depth-first search restricted to markings satisfying p.
+	// As every such marking may lie on the run, any cycle is a witness, so it suffices
+	// to find a successor that includes a marking on the depth-first stack; no nested
+	// search is needed. A successor that is merely included in a stack marking does
+	// not close a cycle and is explored on its own. A successor included in a marking
+	// that was fully explored is dropped, since that marking had no witness. Nodes on
+	// the stack are WAITING, explored nodes PASSED.
+	class LivenessSearch : public SearchStrategy
+	{
+	private:
+		typedef std::list<NodeIndex> NodeList;
+		typedef google::sparse_hash_map<size_t, NodeList> HashMap;
+
+		// The transitions of a marking are fired one at a time, so the stack only holds
+		// the successors of one transition per marking.
+		struct Frame
+		{
+			NodeIndex node;
+			SymbolicMarking* marking;
+			unsigned int transition; // next transition to fire
+			std::vector<Successor> successors; // of the last transition fired
+			unsigned int next; // first successor not looked at yet
+			bool fired; // some transition had a successor
+			bool cut; // some successor was beyond the k-bound
+
+			Frame(NodeIndex node, SymbolicMarking* marking) : node(node), marking(marking), transition(0), successors(), next(0), fired(false), cut(false) { };
+		};
+
+	public:
+		LivenessSearch(
+			const VerifyTAPN::TAPN::TimedArcPetriNet& tapn,
+			SymbolicMarking* initialMarking,
+			const AST::Query* query,
+			const VerificationOptions& options,
+			MarkingFactory* factory
+		);
+		virtual ~LivenessSearch();
+		virtual void AddQuery(const AST::Query* query);
+		virtual void Init() { };
+
+		virtual bool Verify();
+		virtual const std::vector<QueryResult>& GetQueryResults() const { return results; };
+		virtual unsigned int MaxUsedTokens() const { return succGen.MaxUsedTokens(); };
+		virtual Stats GetStats() const { return stats; };
+		virtual void PrintTraceIfAny(bool result) const { };
+		virtual void PrintTransitionStatistics() const;
+		virtual void ExportTransitionStatistics(std::ostream& out, StatisticsFormat format) const;
+	private:
+		bool FindMaximalRun();
+		void Prepare(SymbolicMarking& marking);
+		bool Satisfies(const SymbolicMarking& marking) const;
+		bool CanDelayForever(const SymbolicMarking& marking) const;
+		bool CanTimeLock(const SymbolicMarking& marking);
+		NodeIndex Insert(const SymbolicMarking& marking, bool& onStack);
+		bool Expand(SymbolicMarking* marking, NodeIndex node);
+		void FireNextTransition(Frame& frame);
+	private:
+		NodeStore nodes;
+		HashMap map;
+		std::vector<Frame> stack;
+		Stats stats;
+		const VerifyTAPN::TAPN::TimedArcPetriNet& tapn;
+		SymbolicMarking* initialMarking;
+		QueryChecker checker;
+		std::vector<QueryResult> results;
+		VerificationOptions options;
+		SuccessorGenerator succGen;
+		MarkingFactory* factory;
+		int* maxConstantsArray;
+	};
+}
+
+#endif /* LIVENESSSEARCH_HPP_ */
@@ -0,0 +1,55 @@
+#include "ProgressReporter.hpp"
+#include <fstream>
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+namespace VerifyTAPN
+{
+	void ProgressReporter::Report(time_t now, const PassedWaitingList& pwList, unsigned int maxUsedTokens)
+	{
+		Stats stats = pwList.GetStats();
+		long long elapsed = now - start;
+		long long statesPerSecond = (stats.exploredStates - lastExplored) / (now > lastReport ? now - lastReport : 1);
+		long rss = CurrentRSS();
+
+		if(json)
+		{
+			out << "{\"time\":" << elapsed;
+			out << ",\"explored\":" << stats.exploredStates;
+			out << ",\"discovered\":" << stats.discoveredStates;
+			out << ",\"stored\":" << stats.storedStates;
+			out << ",\"states_per_second\":" << statesPerSecond;
+			out << ",\"waiting\":" << pwList.WaitingSize();
+			out << ",\"waiting_including_covered\":" << pwList.WaitingSizeIncludingCovered();
+			out << ",\"rss_kb\":" << rss;
+			out << ",\"max_tokens\":" << maxUsedTokens << "}" << std::endl;
+		}
+		else
+		{
+			out << "[" << elapsed << "s] explored: " << stats.exploredStates;
+			out << ", discovered: " << stats.discoveredStates;
+			out << ", stored: " << stats.storedStates;
+			out << ", states/s: " << statesPerSecond;
+			out << ", waiting: " << pwList.WaitingSize() << "/" << pwList.WaitingSizeIncludingCovered();
+			out << ", rss: ";
+			if(rss < 0) out << "n/a"; else out << rss << " KB";
+			out << ", max tokens: " << maxUsedTokens << std::endl;
+		}
+
+		lastReport = now;
+		lastExplored = stats.exploredStates;
+	}
+
+	// Resident set size in KB, or -1 where it cannot be determined.
+	long ProgressReporter::CurrentRSS() const
+	{
+#ifdef __linux__
+		std::ifstream statm("/proc/self/statm");
+		long size = 0, resident = 0;
+		if(statm >> size >> resident)
+			return resident * (sysconf(_SC_PAGESIZE) / 1024);
+#endif
+		return -1;
+	}
+}
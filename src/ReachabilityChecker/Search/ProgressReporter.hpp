@@ -0,0 +1,47 @@
+#ifndef PROGRESSREPORTER_HPP_
+#define PROGRESSREPORTER_HPP_
+
+#include <iostream>
+#include <ctime>
+#include "../PassedWaitingList/PassedWaitingList.hpp"
+
+namespace VerifyTAPN
+{
+	// Periodically prints the progress of the search, either as a human readable
+	// line or as a JSON object per line. Update() is called once per explored state
+	// and only compares the wall clock against the next report time, so the
+	// reporter costs next to nothing between reports.
+	class ProgressReporter
+	{
+	public:
+		ProgressReporter(unsigned int interval, bool json, std::ostream& out = std::cerr)
+			: interval(interval), json(json), out(out), start(time(NULL)), nextReport(start + interval), lastReport(start), lastExplored(0) { };
+
+		inline void Update(const PassedWaitingList& pwList, unsigned int maxUsedTokens)
+		{
+			if(interval == 0) return;
+
+			time_t now = time(NULL);
+			if(now >= nextReport)
+			{
+				Report(now, pwList, maxUsedTokens);
+				nextReport = now + interval;
+			}
+		};
+
+	private:
+		void Report(time_t now, const PassedWaitingList& pwList, unsigned int maxUsedTokens);
+		long CurrentRSS() const;
+
+	private:
+		unsigned int interval;
+		bool json;
+		std::ostream& out;
+		time_t start;
+		time_t nextReport;
+		time_t lastReport;
+		long long lastExplored;
+	};
+}
+
+#endif /* PROGRESSREPORTER_HPP_ */
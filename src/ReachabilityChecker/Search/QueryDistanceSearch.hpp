@@ -0,0 +1,46 @@
+#ifndef QUERYDISTANCESEARCH_HPP_
+#define QUERYDISTANCESEARCH_HPP_
+
+#include "SearchStrategy.hpp"
+#include "../PassedWaitingList/PriorityQueueWaitingList.hpp"
+#include "../PassedWaitingList/Node.hpp"
+#include "../../Core/QueryParser/AST.hpp"
+#include "../../Core/QueryParser/QueryDistanceVisitor.hpp"
+#include "boost/make_shared.hpp"
+
+namespace VerifyTAPN
+{
+	// Best-first search towards a marking that ends the search, i.e. one satisfying
+	// the proposition of an EF query or violating the proposition of an AG query.
+	struct QueryDistance : public std::unary_function<Node, int>
+	{
+		explicit QueryDistance(const AST::Query* query) : distance(boost::make_shared<AST::QueryDistanceVisitor>(*query, query->GetQuantifier() == AST::AG)) { };
+
+		int operator()(const Node& node) const
+		{
+			return -distance->Distance(*node.GetMarking()); // the waiting list serves the largest weight first
+		}
+	private:
+		boost::shared_ptr<AST::QueryDistanceVisitor> distance; // shared by the copies of the functor
+	};
+
+	class QueryDistanceSearch : public DefaultSearchStrategy
+	{
+	public:
+		QueryDistanceSearch(
+			const VerifyTAPN::TAPN::TimedArcPetriNet& tapn,
+			SymbolicMarking* initialMarking,
+			const AST::Query* query,
+			const VerificationOptions& options,
+			MarkingFactory* factory
+		) : DefaultSearchStrategy(tapn, initialMarking, query, options, factory), query(query) { };
+
+	protected:
+		virtual WaitingList* CreateWaitingList(NodeStore& nodes) const { return new PriorityQueueWaitingList<QueryDistance>(nodes, QueryDistance(query)); };
+	private:
+		const AST::Query* query;
+	};
+
+}
+
+#endif /* QUERYDISTANCESEARCH_HPP_ */
@@ -7,9 +7,9 @@
 
 namespace VerifyTAPN
 {
-	struct Random : public std::unary_function<Node*, int>
+	struct Random : public std::unary_function<Node, int>
 	{
-		int operator()(const Node* node) const
+		int operator()(const Node& node) const
 		{
 			return rand() % 1000;
 		}
@@ -27,7 +27,7 @@ namespace VerifyTAPN
 		) : DefaultSearchStrategy(tapn, initialMarking, query, options, factory) { };
 
 	protected:
-		virtual WaitingList* CreateWaitingList() const { return new PriorityQueueWaitingList<Random>; };
+		virtual WaitingList* CreateWaitingList(NodeStore& nodes) const { return new PriorityQueueWaitingList<Random>(nodes); };
 	};
 
 }
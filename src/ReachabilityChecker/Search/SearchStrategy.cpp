@@ -2,16 +2,25 @@
 #include "../../Core/TAPN/TimedArcPetriNet.hpp"
 #include "../Successor.hpp"
 #include "../../typedefs.hpp"
+#include "../../Core/BinaryStream.hpp"
+#include "../../Core/Profiler.hpp"
+#include "../../Core/QueryParser/VisiblePlacesVisitor.hpp"
+#include <fstream>
+#include <cstdio>
+#include <ctime>
 
 namespace VerifyTAPN
 {
+	static const unsigned int CHECKPOINT_MAGIC = 0x50434B56; // "VKCP"
+	static const unsigned int CHECKPOINT_VERSION = 3;
+
 	DefaultSearchStrategy::DefaultSearchStrategy(
 		const VerifyTAPN::TAPN::TimedArcPetriNet& tapn,
 		SymbolicMarking* initialMarking,
 		const AST::Query* query,
 		const VerificationOptions& options,
 		MarkingFactory* factory
-	) : tapn(tapn), initialMarking(initialMarking), checker(query), options(options), succGen(tapn, *factory, options, initialMarking->NumberOfTokens()), factory(factory), traceStore(options, initialMarking, tapn)
+	) : nodes(), tapn(tapn), initialMarking(initialMarking), checkers(1, boost::shared_ptr<const QueryChecker>(new QueryChecker(query))), results(1), pending(1), start(), options(options), succGen(tapn, *factory, options, initialMarking->NumberOfTokens()), factory(factory), traceStore(options, initialMarking, tapn), progress(options.GetProgressInterval(), options.JsonProgress())
 	{
 		maxConstantsArray = new int[options.GetKBound()+1];
 		for(unsigned int i = 0; i < options.GetKBound()+1; ++i)
@@ -20,9 +29,38 @@ namespace VerifyTAPN
 		}
 	};
 
+	// Further queries are checked during the same search. They must be added before Init.
+	void DefaultSearchStrategy::AddQuery(const AST::Query* query)
+	{
+		checkers.push_back(boost::shared_ptr<const QueryChecker>(new QueryChecker(query)));
+		results.push_back(QueryResult());
+		pending++;
+	}
+
+	void DefaultSearchStrategy::Init()
+	{
+		if(options.GetPartialOrderReductionEnabled())
+		{
+			AST::VisiblePlacesVisitor visitor; // collects the places of all queries
+			for(unsigned int i = 0; i < checkers.size(); i++)
+				visitor.FindVisiblePlaces(checkers[i]->GetQuery());
+			succGen.EnablePartialOrderReduction(visitor.GetVisiblePlaces());
+		}
+
+		// the old factory stores the successors themselves, so there is nothing to keep
+		unsigned int maxExpanded = options.GetFactory() == OLD_FACTORY ? 0 : options.GetKeptExpandedMarkings();
+		if(options.GetExactPassedListEnabled())
+			pwList = new ExactPWList(nodes, CreateWaitingList(nodes), factory, options.GetInclusionWindow(), maxExpanded);
+		else
+			pwList = new PWList(nodes, CreateWaitingList(nodes), factory, maxExpanded);
+	}
+
 	bool DefaultSearchStrategy::Verify()
 	{
 		std::vector<TraceInfo::Invariant> lastInvariant;
+		bool trace = options.GetTrace() != NONE;
+		time_t nextCheckpoint = time(NULL) + options.GetCheckpointInterval();
+		start = std::chrono::steady_clock::now();
 
 		initialMarking->Delay();
 		UpdateMaxConstantsArray(*initialMarking);
@@ -33,71 +71,134 @@ namespace VerifyTAPN
 			initialMarking->MakeSymmetric(bimap);
 		}
 
-		pwList->Add(*initialMarking);
-		if(CheckQuery(*initialMarking)){
-			if(options.GetTrace() != NONE){
-				CreateLastInvariant(*initialMarking, lastInvariant);
-				traceStore.SetFinalMarkingIdAndInvariant(initialMarking->UniqueId(), lastInvariant);
+		if(options.Resume())
+		{
+			ReadCheckpoint(); // the initial marking was already checked by the run that wrote the checkpoint
+		}
+		else
+		{
+			pwList->Add(*initialMarking);
+			if(CheckQueries(*initialMarking)){
+				if(options.GetTrace() != NONE){
+					CreateLastInvariant(*initialMarking, lastInvariant);
+					traceStore.SetFinalMarkingIdAndInvariant(initialMarking->UniqueId(), lastInvariant);
+				}
+				factory->Release(initialMarking);
+				return results[0].satisfied;
 			}
-			factory->Release(initialMarking);
-			return checker.IsEF(); // return true if EF query (proof found), or false if AG query (counter example found)
 		}
 
 		while(pwList->HasWaitingStates())
 		{
-			SymbolicMarking* next = pwList->GetNextUnexplored();
+			SymbolicMarking* next;
+			{
+				PROFILE_SCOPE(NEXT_UNEXPLORED);
+				next = pwList->GetNextUnexplored();
+			}
 
 			typedef std::vector<Successor> SuccessorVector;
 			SuccessorVector successors;
+			bool expandRemaining = false;
 
-			succGen.GenerateDiscreteTransitionsSuccessors(*next, successors);
-
-			for(SuccessorVector::iterator iter = successors.begin(); iter != successors.end(); ++iter)
+			do
 			{
-				SymbolicMarking& succ = *(*iter).Marking();
-				succ.Delay();
+				{
+					PROFILE_SCOPE(SUCCESSOR_GENERATION);
+					if(expandRemaining)
+						succGen.GenerateRemainingSuccessors(*next, successors);
+					else
+						succGen.GenerateDiscreteTransitionsSuccessors(*next, successors);
+				}
 
-				UpdateMaxConstantsArray(succ);
+				bool reachedOld = false;
+				for(SuccessorVector::iterator iter = successors.begin(); iter != successors.end(); ++iter)
+				{
+					SymbolicMarking& succ = *(*iter).Marking();
 
-				succ.Extrapolate(maxConstantsArray);
+					// The queries only depend on the discrete part, and the zone of a generated
+					// successor is never empty, so without a trace to record the queries are
+					// checked before any further work on the zone.
+					if(!trace && CheckQueries(succ))
+					{
+						ReleaseRemaining(next, iter, successors.end());
+						return results[0].satisfied;
+					}
 
-				BiMap bimap; // If symmetry is not enabled but trace is requested, TraceStore will provide an identity mapping
-				if(options.GetSymmetryEnabled())
-				{
-					succ.MakeSymmetric(bimap);
-				}
-				if(options.GetTrace() != NONE){
-					TraceInfo* traceInfo = iter->GetTraceInfo();
-					IndirectionTable table(bimap);
-					traceInfo->SetSymmetricMapping(table);
-					traceStore.Save(succ.UniqueId(), traceInfo);
-				}
+					{
+						PROFILE_SCOPE(DELAY);
+						succ.Delay();
+					}
+
+					{
+						PROFILE_SCOPE(EXTRAPOLATE);
+						UpdateMaxConstantsArray(succ);
+
+						succ.Extrapolate(maxConstantsArray);
+					}
 
-				bool added = pwList->Add(succ);
+					BiMap bimap; // If symmetry is not enabled but trace is requested, TraceStore will provide an identity mapping
+					if(options.GetSymmetryEnabled())
+					{
+						PROFILE_SCOPE(MAKE_SYMMETRIC);
+						succ.MakeSymmetric(bimap);
+					}
+					if(trace){
+						PROFILE_SCOPE(TRACE_STORE);
+						TraceInfo* traceInfo = iter->GetTraceInfo();
+						IndirectionTable table(bimap);
+						traceInfo->SetSymmetricMapping(table);
+						traceStore.Save(succ.UniqueId(), traceInfo);
+					}
 
-				if(added && CheckQuery(succ)){
-					if(options.GetTrace() != NONE)
+					bool added, kept;
 					{
+						PROFILE_SCOPE(PWLIST_ADD);
+						added = pwList->Add(iter->Marking(), kept);
+					}
+					succGen.RecordSuccessorAdded(iter->TransitionIndex(), added);
+					reachedOld = reachedOld || !added;
+					if(!trace && !added) PROFILE_COUNT(UNSTORED_QUERY_CHECKS); // checked above, but the old order would not have
+
+					if(trace && added && CheckQueries(succ)){
 						CreateLastInvariant(succ, lastInvariant);
 						traceStore.SetFinalMarkingIdAndInvariant(succ.UniqueId(), lastInvariant);
-					}
 
-					factory->Release(iter->Marking());
-					return checker.IsEF();
+						if(!kept) factory->Release(iter->Marking());
+						ReleaseRemaining(next, iter + 1, successors.end());
+						return results[0].satisfied;
+					}
+					if(!kept) factory->Release(iter->Marking());
 				}
-				factory->Release(iter->Marking());
-			}
+
+				// Cycle proviso for partial order reduction: a reduced expansion reaching a state
+				// that was seen before is completed, so every cycle has a fully expanded state.
+				expandRemaining = succGen.IsReduced() && reachedOld;
+				successors.clear();
+			} while(expandRemaining);
 			factory->Release(next);
 
 			//PrintDiagnostics(successors.size());
+			progress.Update(*pwList, succGen.MaxUsedTokens());
+
+			if(options.GetCheckpointInterval() > 0 && time(NULL) >= nextCheckpoint)
+			{
+				WriteCheckpoint();
+				nextCheckpoint = time(NULL) + options.GetCheckpointInterval();
+			}
 		}
-		return checker.IsAG(); // return true if AG query (no counter example found), false if EF query (no proof found)
+
+		// nothing decides the remaining queries: no proof for EF queries, no counter example for AG queries
+		for(unsigned int i = 0; i < checkers.size(); i++)
+		{
+			if(!results[i].decided) Decide(i, checkers[i]->IsAG());
+		}
+		return results[0].satisfied;
 	}
 
 	// Finds the local max constants for each token to be used for extrapolation.
 	// If infinity place optimization is enabled, tokens in such a place are "marked"
 	// as inactive by supplying a max constant of -dbm_INFINITY.
-	void DefaultSearchStrategy::UpdateMaxConstantsArray(const SymbolicMarking& marking)
+	void UpdateMaxConstantsArray(const TAPN::TimedArcPetriNet& tapn, const VerificationOptions& options, const SymbolicMarking& marking, int* maxConstantsArray)
 	{
 		for(unsigned int tokenIndex = 0; tokenIndex < marking.NumberOfTokens(); ++tokenIndex)
 		{
@@ -115,10 +216,46 @@ namespace VerifyTAPN
 		}
 	}
 
-	bool DefaultSearchStrategy::CheckQuery(const SymbolicMarking& marking) const
+	void DefaultSearchStrategy::UpdateMaxConstantsArray(const SymbolicMarking& marking)
+	{
+		VerifyTAPN::UpdateMaxConstantsArray(tapn, options, marking, maxConstantsArray);
+	}
+
+	// Checks the marking against every pending query and decides those it settles, i.e.
+	// EF queries it satisfies (proof found) and AG queries it violates (counter example
+	// found). Returns true once no query is pending.
+	bool DefaultSearchStrategy::CheckQueries(const SymbolicMarking& marking)
+	{
+		PROFILE_SCOPE(QUERY_CHECK);
+		for(unsigned int i = 0; i < checkers.size(); i++)
+		{
+			if(results[i].decided) continue;
+
+			const QueryChecker& checker = *checkers[i];
+			bool satisfied = checker.IsExpressionSatisfied(marking);
+			if((satisfied && checker.IsEF()) || (!satisfied && checker.IsAG()))
+				Decide(i, checker.IsEF());
+		}
+		return pending == 0;
+	}
+
+	void DefaultSearchStrategy::Decide(unsigned int query, bool satisfied)
 	{
-		bool satisfied = checker.IsExpressionSatisfied(marking);
-		return (satisfied && checker.IsEF()) || (!satisfied && checker.IsAG());
+		QueryResult& result = results[query];
+		assert(!result.decided);
+		result.decided = true;
+		result.satisfied = satisfied;
+		result.stats = pwList->GetStats();
+		result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		pending--;
+	}
+
+	// Releases the marking being expanded and its successors from the given one on,
+	// when the search stops before they are stored.
+	void DefaultSearchStrategy::ReleaseRemaining(SymbolicMarking* marking, std::vector<Successor>::const_iterator from, std::vector<Successor>::const_iterator end) const
+	{
+		for(; from != end; ++from) factory->Release(from->Marking());
+		factory->Release(marking);
 	}
 
 	void DefaultSearchStrategy::CreateLastInvariant(const SymbolicMarking& marking, std::vector<TraceInfo::Invariant>& invariants) const
@@ -135,6 +272,68 @@ namespace VerifyTAPN
 		}
 	}
 
+	// The checkpoint is written straight to disk, one marking at a time. It goes to a
+	// temporary file first, so a crash while writing leaves the previous checkpoint intact.
+	void DefaultSearchStrategy::WriteCheckpoint() const
+	{
+		std::string file = options.CheckpointFile();
+		std::string tmp = file + ".tmp";
+		{
+			std::ofstream stream(tmp.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+			BinaryWriter out(stream);
+			out.Write(CHECKPOINT_MAGIC);
+			out.Write(CHECKPOINT_VERSION);
+			out.Write(options.GetFactory());
+			out.Write(options.GetKBound());
+			out.Write(options.GetSymmetryEnabled());
+			out.Write(options.GetTrace());
+			out.Write(tapn.NumberOfPlaces());
+			out.Write(tapn.GetNumberOfTransitions());
+			out.WriteVector(results);
+
+			factory->WriteState(out);
+			succGen.Save(out);
+			pwList->Save(out);
+			if(options.GetTrace() != NONE) traceStore.Save(out);
+
+			if(!out.Good())
+			{
+				std::cerr << "Could not write checkpoint to " << tmp << std::endl;
+				return;
+			}
+		}
+		std::rename(tmp.c_str(), file.c_str());
+	}
+
+	void DefaultSearchStrategy::ReadCheckpoint()
+	{
+		std::ifstream stream(options.CheckpointFile().c_str(), std::ios::in | std::ios::binary);
+		if(!stream) throw std::string("could not open " + options.CheckpointFile());
+
+		BinaryReader in(stream);
+		if(in.Read<unsigned int>() != CHECKPOINT_MAGIC || in.Read<unsigned int>() != CHECKPOINT_VERSION)
+			throw std::string("not a checkpoint file");
+		if(in.Read<Factory>() != options.GetFactory() || in.Read<unsigned int>() != options.GetKBound()
+				|| in.Read<bool>() != options.GetSymmetryEnabled() || in.Read<Trace>() != options.GetTrace())
+			throw std::string("the checkpoint was written with different options");
+		if(in.Read<int>() != tapn.NumberOfPlaces() || in.Read<int>() != tapn.GetNumberOfTransitions())
+			throw std::string("the checkpoint was written for a different model");
+
+		std::vector<QueryResult> saved;
+		in.ReadVector(saved);
+		if(saved.size() != results.size())
+			throw std::string("the checkpoint was written for a different number of queries");
+		results.swap(saved);
+		pending = 0;
+		for(std::vector<QueryResult>::const_iterator it = results.begin(); it != results.end(); ++it)
+			if(!it->decided) pending++;
+
+		factory->ReadState(in);
+		succGen.Load(in);
+		pwList->Load(in);
+		if(options.GetTrace() != NONE) traceStore.Load(in);
+	}
+
 	Stats DefaultSearchStrategy::GetStats() const
 	{
 		return pwList->GetStats();
@@ -150,7 +349,7 @@ namespace VerifyTAPN
 	void DefaultSearchStrategy::PrintTraceIfAny(bool result) const
 	{
 		if(options.GetTrace() != NONE){
-			if((checker.IsAG() && result) || (checker.IsEF() && !result))
+			if((checkers[0]->IsAG() && result) || (checkers[0]->IsEF() && !result))
 				std::cout << "A trace could not be generated due to the query result." << std::endl;
 			else{
 				traceStore.OutputTraceTo(tapn);
@@ -162,4 +361,8 @@ namespace VerifyTAPN
 		succGen.PrintTransitionStatistics(std::cout);
 		return;
 	}
+
+	void DefaultSearchStrategy::ExportTransitionStatistics(std::ostream& out, StatisticsFormat format) const {
+		succGen.ExportTransitionStatistics(out, format);
+	}
 }
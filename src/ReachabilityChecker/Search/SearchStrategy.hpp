@@ -3,10 +3,15 @@
 
 #include "../PassedWaitingList/WaitingList.hpp"
 #include "../PassedWaitingList/PWList.hpp"
+#include "../PassedWaitingList/ExactPWList.hpp"
 #include "../QueryChecker/QueryChecker.hpp"
 #include "../../Core/VerificationOptions.hpp"
 #include "../Trace/TraceStore.hpp"
 #include "../SuccessorGenerator.hpp"
+#include "ProgressReporter.hpp"
+#include "boost/smart_ptr.hpp"
+#include <vector>
+#include <chrono>
 
 namespace VerifyTAPN
 {
@@ -21,19 +26,34 @@ namespace VerifyTAPN
 		class Query;
 	}
 
+	// The outcome of one of the queries checked during a search.
+	struct QueryResult
+	{
+		bool decided; // false while the query is pending
+		bool satisfied;
+		Stats stats; // of the passed-waiting list when the query was decided
+		double seconds; // since the search started
+
+		QueryResult() : decided(false), satisfied(false), stats(), seconds(0) { };
+	};
+
 	class SearchStrategy
 	{
 	public:
 		virtual ~SearchStrategy() { };
+		virtual void AddQuery(const AST::Query* query) = 0;
 		virtual void Init() = 0;
 		virtual bool Verify() = 0;
+		virtual const std::vector<QueryResult>& GetQueryResults() const = 0;
 		virtual unsigned int MaxUsedTokens() const = 0;
 		virtual Stats GetStats() const = 0;
 		virtual void PrintTraceIfAny(bool result) const = 0;
 		virtual void PrintTransitionStatistics() const = 0;
+		virtual void ExportTransitionStatistics(std::ostream& out, StatisticsFormat format) const = 0;
 	};
 
 
+	void UpdateMaxConstantsArray(const TAPN::TimedArcPetriNet& tapn, const VerificationOptions& options, const SymbolicMarking& marking, int* maxConstantsArray);
 
 	class DefaultSearchStrategy : public SearchStrategy
 	{
@@ -46,32 +66,41 @@ namespace VerifyTAPN
 			MarkingFactory* factory
 		);
 		virtual ~DefaultSearchStrategy() { delete pwList; delete[] maxConstantsArray; };
-		virtual void Init()
-		{
-			pwList = new PWList(CreateWaitingList(), factory);
-		}
+		virtual void AddQuery(const AST::Query* query);
+		virtual void Init();
 
 		virtual bool Verify();
+		virtual const std::vector<QueryResult>& GetQueryResults() const { return results; };
 		virtual unsigned int MaxUsedTokens() const { return succGen.MaxUsedTokens(); };
 		virtual Stats GetStats() const;
 		virtual void PrintTraceIfAny(bool result) const;
 		virtual void PrintTransitionStatistics() const;
+		virtual void ExportTransitionStatistics(std::ostream& out, StatisticsFormat format) const;
 	protected:
-		virtual WaitingList* CreateWaitingList() const = 0;
+		virtual WaitingList* CreateWaitingList(NodeStore& nodes) const = 0;
 	private:
-		virtual bool CheckQuery(const SymbolicMarking& marking) const;
+		virtual bool CheckQueries(const SymbolicMarking& marking);
+		void Decide(unsigned int query, bool satisfied);
+		void ReleaseRemaining(SymbolicMarking* marking, std::vector<Successor>::const_iterator from, std::vector<Successor>::const_iterator end) const;
 		virtual void CreateLastInvariant(const SymbolicMarking& marking, std::vector<TraceInfo::Invariant>& invariants) const;
 		void PrintDiagnostics(size_t successors) const;
 		void UpdateMaxConstantsArray(const SymbolicMarking& marking);
+		void WriteCheckpoint() const;
+		void ReadCheckpoint();
 	private:
+		NodeStore nodes; // outlives pwList, which is deleted in the destructor body
 		PassedWaitingList* pwList;
 		const VerifyTAPN::TAPN::TimedArcPetriNet& tapn;
 		SymbolicMarking* initialMarking;
-		const QueryChecker checker;
+		std::vector< boost::shared_ptr<const QueryChecker> > checkers;
+		std::vector<QueryResult> results; // one per checker
+		unsigned int pending; // queries not decided yet
+		std::chrono::steady_clock::time_point start;
 		VerificationOptions options;
 		SuccessorGenerator succGen;
 		MarkingFactory* factory;
 		TraceStore traceStore;
+		ProgressReporter progress;
 		int* maxConstantsArray;
 	};
 }
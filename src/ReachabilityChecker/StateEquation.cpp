@@ -0,0 +1,275 @@
+#include "StateEquation.hpp"
+#include "LinearProgram.hpp"
+#include <map>
+
+namespace VerifyTAPN {
+	StateEquation::StateEquation(const TAPN::TimedArcPetriNet& tapn, const std::vector<int>& initialPlacement)
+		: incidence(tapn.NumberOfPlaces(), std::vector<long long>(tapn.GetNumberOfTransitions(), 0)), initialMarking(tapn.NumberOfPlaces(), 0)
+	{
+		std::map<const TAPN::TimedTransition*, unsigned int> columns;
+		for(unsigned int t = 0; t < tapn.GetTransitions().size(); t++) columns[tapn.GetTransitions()[t].get()] = t;
+
+		for(TAPN::TimedInputArc::Vector::const_iterator iter = tapn.GetInputArcs().begin(); iter != tapn.GetInputArcs().end(); ++iter)
+		{
+			incidence[(*iter)->InputPlace().GetIndex()][columns[&(*iter)->OutputTransition()]]--;
+		}
+		for(TAPN::TransportArc::Vector::const_iterator iter = tapn.GetTransportArcs().begin(); iter != tapn.GetTransportArcs().end(); ++iter)
+		{
+			unsigned int t = columns[&(*iter)->Transition()];
+			incidence[(*iter)->Source().GetIndex()][t]--;
+			incidence[(*iter)->Destination().GetIndex()][t]++;
+		}
+		for(TAPN::OutputArc::Vector::const_iterator iter = tapn.GetOutputArcs().begin(); iter != tapn.GetOutputArcs().end(); ++iter)
+		{
+			incidence[(*iter)->OutputPlace().GetIndex()][columns[&(*iter)->InputTransition()]]++;
+		}
+
+		for(std::vector<int>::const_iterator iter = initialPlacement.begin(); iter != initialPlacement.end(); ++iter)
+		{
+			initialMarking[*iter]++;
+		}
+	}
+
+	bool StateEquation::ProvesUnreachable(const AST::Query& query) const
+	{
+		if(query.GetQuantifier() != AST::EF && query.GetQuantifier() != AST::AG) return false;
+
+		unsigned int places = incidence.size();
+		unsigned int transitions = places > 0 ? incidence[0].size() : 0;
+
+		ConstraintCollector collector(places);
+		ConstraintCollector::Disjunction disjuncts;
+		if(!collector.Collect(query.Child(), query.GetQuantifier() == AST::AG, disjuncts)) return false;
+
+		for(ConstraintCollector::Disjunction::const_iterator conjunction = disjuncts.begin(); conjunction != disjuncts.end(); ++conjunction)
+		{
+			LinearProgram program(transitions);
+
+			// M(p) = M0(p) + C(p) x >= 0
+			for(unsigned int p = 0; p < places; p++)
+			{
+				std::vector<long long> coefficients(transitions);
+				bool changes = false;
+				for(unsigned int t = 0; t < transitions; t++)
+				{
+					coefficients[t] = -incidence[p][t];
+					changes = changes || coefficients[t] != 0;
+				}
+				if(changes) program.AddConstraint(coefficients, LinearProgram::LESS_EQUAL, initialMarking[p]);
+			}
+
+			// a M <= b becomes (a C) x <= b - a M0
+			for(ConstraintCollector::Conjunction::const_iterator constraint = conjunction->begin(); constraint != conjunction->end(); ++constraint)
+			{
+				std::vector<long long> coefficients(transitions, 0);
+				long long bound = constraint->bound;
+				for(unsigned int p = 0; p < places; p++)
+				{
+					long long a = constraint->coefficients[p];
+					if(a == 0) continue;
+					long long product;
+					if(!CheckedMultiply(a, initialMarking[p], product) || !CheckedSubtract(bound, product, bound)) return false;
+					for(unsigned int t = 0; t < transitions; t++)
+					{
+						if(!CheckedMultiply(a, incidence[p][t], product) || !CheckedAdd(coefficients[t], product, coefficients[t])) return false;
+					}
+				}
+				program.AddConstraint(coefficients, constraint->equality ? LinearProgram::EQUAL : LinearProgram::LESS_EQUAL, bound);
+			}
+
+			if(program.IsIntegerFeasible() != LinearProgram::INFEASIBLE) return false;
+		}
+		return true;
+	}
+
+	bool ConstraintCollector::Collect(const AST::Expression& proposition, bool negate, Disjunction& result)
+	{
+		negated = negate;
+		linear = true;
+		result = Evaluate(proposition);
+		return linear;
+	}
+
+	ConstraintCollector::LinearExpression ConstraintCollector::Evaluate(const AST::ArithmeticExpression& expr)
+	{
+		boost::any context;
+		expr.Accept(*this, context);
+		return boost::any_cast<LinearExpression>(context);
+	}
+
+	ConstraintCollector::Disjunction ConstraintCollector::Evaluate(const AST::Expression& expr)
+	{
+		boost::any context;
+		expr.Accept(*this, context);
+		return boost::any_cast<Disjunction>(context);
+	}
+
+	ConstraintCollector::Disjunction ConstraintCollector::Combine(const Disjunction& left, const Disjunction& right, bool conjunction)
+	{
+		Disjunction result;
+		if(conjunction)
+		{
+			if(left.size() * right.size() > MAX_DISJUNCTS)
+			{
+				linear = false;
+				return result;
+			}
+			for(Disjunction::const_iterator l = left.begin(); l != left.end(); ++l)
+			{
+				for(Disjunction::const_iterator r = right.begin(); r != right.end(); ++r)
+				{
+					result.push_back(*l);
+					result.back().insert(result.back().end(), r->begin(), r->end());
+				}
+			}
+		}
+		else
+		{
+			if(left.size() + right.size() > MAX_DISJUNCTS)
+			{
+				linear = false;
+				return result;
+			}
+			result = left;
+			result.insert(result.end(), right.begin(), right.end());
+		}
+		return result;
+	}
+
+	void ConstraintCollector::Visit(const AST::NotExpression& expr, boost::any& context)
+	{
+		negated = !negated;
+		context = Evaluate(expr.Child());
+		negated = !negated;
+	}
+
+	void ConstraintCollector::Visit(const AST::OrExpression& expr, boost::any& context)
+	{
+		context = Combine(Evaluate(expr.Left()), Evaluate(expr.Right()), negated);
+	}
+
+	void ConstraintCollector::Visit(const AST::AndExpression& expr, boost::any& context)
+	{
+		context = Combine(Evaluate(expr.Left()), Evaluate(expr.Right()), !negated);
+	}
+
+	// As token counts and constants are integers, strict inequalities are turned
+	// into non-strict ones by moving the bound by one.
+	void ConstraintCollector::Visit(const AST::AtomicProposition& expr, boost::any& context)
+	{
+		LinearExpression left = Evaluate(expr.GetLeft());
+		LinearExpression right = Evaluate(expr.GetRight());
+
+		// left op right  <=>  a M + c op 0
+		std::vector<long long> a(places), minusA(places);
+		for(unsigned int p = 0; p < places; p++)
+		{
+			Require(CheckedSubtract(left.coefficients[p], right.coefficients[p], a[p]));
+			minusA[p] = -a[p];
+		}
+		long long c = 0, cMinusOne = 0, minusCMinusOne = 0;
+		Require(CheckedSubtract(left.constant, right.constant, c) && CheckedSubtract(c, 1, cMinusOne) && CheckedSubtract(-c, 1, minusCMinusOne));
+
+		std::string op = expr.Operator();
+		if(op == "==") op = "=";
+		if(negated)
+		{
+			if(op == "<") op = ">=";
+			else if(op == "<=") op = ">";
+			else if(op == "=") op = "!=";
+			else if(op == ">=") op = "<";
+			else if(op == ">") op = "<=";
+			else if(op == "!=") op = "=";
+		}
+
+		Disjunction result;
+		if(op == "<") result.push_back(Conjunction(1, PlaceConstraint(a, false, minusCMinusOne)));
+		else if(op == "<=") result.push_back(Conjunction(1, PlaceConstraint(a, false, -c)));
+		else if(op == "=") result.push_back(Conjunction(1, PlaceConstraint(a, true, -c)));
+		else if(op == ">=") result.push_back(Conjunction(1, PlaceConstraint(minusA, false, c)));
+		else if(op == ">") result.push_back(Conjunction(1, PlaceConstraint(minusA, false, cMinusOne)));
+		else if(op == "!=")
+		{
+			result.push_back(Conjunction(1, PlaceConstraint(a, false, minusCMinusOne)));
+			result.push_back(Conjunction(1, PlaceConstraint(minusA, false, cMinusOne)));
+		}
+		else linear = false;
+		context = result;
+	}
+
+	void ConstraintCollector::Visit(const AST::BoolExpression& expr, boost::any& context)
+	{
+		Disjunction result;
+		if(expr.GetValue() != negated) result.push_back(Conjunction()); // true is the empty conjunction
+		context = result;
+	}
+
+	void ConstraintCollector::Visit(const AST::Query& query, boost::any& context)
+	{
+		context = Evaluate(query.Child());
+	}
+
+	void ConstraintCollector::Visit(const AST::NumberExpression& expr, boost::any& context)
+	{
+		LinearExpression result;
+		result.coefficients.assign(places, 0);
+		result.constant = expr.GetValue();
+		context = result;
+	}
+
+	void ConstraintCollector::Visit(const AST::IdentifierExpression& expr, boost::any& context)
+	{
+		LinearExpression result;
+		result.coefficients.assign(places, 0);
+		result.constant = 0;
+		if(expr.GetPlace() >= 0 && expr.GetPlace() < static_cast<int>(places)) result.coefficients[expr.GetPlace()] = 1;
+		else linear = false;
+		context = result;
+	}
+
+	void ConstraintCollector::Visit(const AST::MultiplyExpression& expr, boost::any& context)
+	{
+		LinearExpression left = Evaluate(expr.GetLeft());
+		LinearExpression right = Evaluate(expr.GetRight());
+
+		bool leftConstant = true, rightConstant = true;
+		for(unsigned int p = 0; p < places; p++)
+		{
+			leftConstant = leftConstant && left.coefficients[p] == 0;
+			rightConstant = rightConstant && right.coefficients[p] == 0;
+		}
+		if(!leftConstant && !rightConstant) linear = false;
+
+		LinearExpression& result = leftConstant ? right : left;
+		long long factor = leftConstant ? left.constant : right.constant;
+		for(unsigned int p = 0; p < places; p++) Require(CheckedMultiply(result.coefficients[p], factor, result.coefficients[p]));
+		Require(CheckedMultiply(result.constant, factor, result.constant));
+		context = result;
+	}
+
+	void ConstraintCollector::Visit(const AST::MinusExpression& expr, boost::any& context)
+	{
+		LinearExpression result = Evaluate(expr.GetValue());
+		for(unsigned int p = 0; p < places; p++) result.coefficients[p] = -result.coefficients[p];
+		result.constant = -result.constant;
+		context = result;
+	}
+
+	void ConstraintCollector::Visit(const AST::SubtractExpression& expr, boost::any& context)
+	{
+		LinearExpression result = Evaluate(expr.GetLeft());
+		LinearExpression right = Evaluate(expr.GetRight());
+		for(unsigned int p = 0; p < places; p++) Require(CheckedSubtract(result.coefficients[p], right.coefficients[p], result.coefficients[p]));
+		Require(CheckedSubtract(result.constant, right.constant, result.constant));
+		context = result;
+	}
+
+	void ConstraintCollector::Visit(const AST::PlusExpression& expr, boost::any& context)
+	{
+		LinearExpression result = Evaluate(expr.GetLeft());
+		LinearExpression right = Evaluate(expr.GetRight());
+		for(unsigned int p = 0; p < places; p++) Require(CheckedAdd(result.coefficients[p], right.coefficients[p], result.coefficients[p]));
+		Require(CheckedAdd(result.constant, right.constant, result.constant));
+		context = result;
+	}
+}
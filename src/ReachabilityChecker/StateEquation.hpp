@@ -0,0 +1,92 @@
+#ifndef STATEEQUATION_HPP_
+#define STATEEQUATION_HPP_
+
+#include <vector>
+#include "../Core/TAPN/TAPN.hpp"
+#include "../Core/QueryParser/AST.hpp"
+#include "../Core/QueryParser/Visitor.hpp"
+
+namespace VerifyTAPN {
+	// Untimed over-approximation of the reachable markings: every reachable marking
+	// M satisfies M = M0 + C x for some vector x >= 0 of firing counts, where C is
+	// the incidence matrix of the net (inhibitor arcs and time are ignored). The
+	// k-bound is deliberately left out, so the answers hold for any k.
+	class StateEquation
+	{
+	public:
+		StateEquation(const TAPN::TimedArcPetriNet& tapn, const std::vector<int>& initialPlacement);
+
+		// True if no marking satisfying the state equation settles the query, i.e.
+		// satisfies the proposition of an EF query or violates that of an AG query.
+		// The query is then not satisfied if it is an EF query, and satisfied if it
+		// is an AG query. False if that cannot be shown, also when a constant would
+		// overflow.
+		bool ProvesUnreachable(const AST::Query& query) const;
+
+	private:
+		std::vector< std::vector<long long> > incidence; // per place, the change of its tokens per transition
+		std::vector<long long> initialMarking;
+	};
+
+	// A linear constraint over the number of tokens in each place:
+	// sum of coefficients[p] * M(p) <= bound, or = bound.
+	struct PlaceConstraint {
+		std::vector<long long> coefficients;
+		bool equality;
+		long long bound;
+
+		PlaceConstraint(const std::vector<long long>& coefficients, bool equality, long long bound) : coefficients(coefficients), equality(equality), bound(bound) { };
+	};
+
+	// Rewrites a query proposition into a disjunction of conjunctions of linear
+	// constraints, which is possible unless places are multiplied together (the
+	// number of disjuncts is bounded as well).
+	class ConstraintCollector : public AST::Visitor
+	{
+	public:
+		typedef std::vector<PlaceConstraint> Conjunction;
+		typedef std::vector<Conjunction> Disjunction;
+
+	public:
+		explicit ConstraintCollector(unsigned int places) : places(places), negated(false), linear(true) { };
+		virtual ~ConstraintCollector() { };
+
+		// The constraints for the markings satisfying the proposition, or violating it
+		// if negated is set. Returns false if the proposition is not linear or one of
+		// its constants overflows.
+		bool Collect(const AST::Expression& proposition, bool negated, Disjunction& result);
+
+		virtual void Visit(const AST::NotExpression& expr, boost::any& context);
+		virtual void Visit(const AST::OrExpression& expr, boost::any& context);
+		virtual void Visit(const AST::AndExpression& expr, boost::any& context);
+		virtual void Visit(const AST::AtomicProposition& expr, boost::any& context);
+		virtual void Visit(const AST::BoolExpression& expr, boost::any& context);
+		virtual void Visit(const AST::Query& query, boost::any& context);
+		virtual void Visit(const AST::NumberExpression& expr, boost::any& context);
+		virtual void Visit(const AST::IdentifierExpression& expr, boost::any& context);
+		virtual void Visit(const AST::MultiplyExpression& expr, boost::any& context);
+		virtual void Visit(const AST::MinusExpression& expr, boost::any& context);
+		virtual void Visit(const AST::SubtractExpression& expr, boost::any& context);
+		virtual void Visit(const AST::PlusExpression& expr, boost::any& context);
+
+	private:
+		struct LinearExpression {
+			std::vector<long long> coefficients;
+			long long constant;
+		};
+
+		LinearExpression Evaluate(const AST::ArithmeticExpression& expr);
+		Disjunction Evaluate(const AST::Expression& expr);
+		Disjunction Combine(const Disjunction& left, const Disjunction& right, bool conjunction);
+		inline void Require(bool noOverflow) { linear = linear && noOverflow; };
+
+	private:
+		static const unsigned int MAX_DISJUNCTS = 64;
+
+		unsigned int places;
+		bool negated; // collecting the constraints for the negation of the current subexpression
+		bool linear;
+	};
+}
+
+#endif /* STATEEQUATION_HPP_ */
@@ -0,0 +1,168 @@
+#include "StubbornSet.hpp"
+#include "../Core/SymbolicMarking/SymbolicMarking.hpp"
+#include <map>
+#include <algorithm>
+
+namespace VerifyTAPN {
+	StubbornSet::StubbornSet(const TAPN::TimedArcPetriNet& tapn, const std::vector<int>& visiblePlaces)
+		: numberOfTransitions(tapn.GetNumberOfTransitions()), inputs(numberOfTransitions), outputs(numberOfTransitions), inhibitors(numberOfTransitions),
+		  consumers(tapn.NumberOfPlaces()), producers(tapn.NumberOfPlaces()), inhibited(tapn.NumberOfPlaces()),
+		  timeInsensitive(numberOfTransitions, true), tokens(tapn.NumberOfPlaces()), stack(), candidate(numberOfTransitions)
+	{
+		std::map<const TAPN::TimedTransition*, unsigned int> indices;
+		for(unsigned int t = 0; t < numberOfTransitions; t++)
+			indices[tapn.GetTransitions()[t].get()] = t;
+
+		// a place is timeless if the age of its tokens can never matter
+		std::vector<bool> timeless(tapn.NumberOfPlaces(), false);
+		for(int p = 0; p < tapn.NumberOfPlaces(); p++)
+			timeless[p] = tapn.GetPlace(p).GetInvariant() == TAPN::TimeInvariant::LS_INF;
+		for(unsigned int p = 0; p < visiblePlaces.size(); p++)
+			if(visiblePlaces[p] >= 0) timeless[visiblePlaces[p]] = false; // not timeless, but just as unfit for reduction
+
+		for(TAPN::TimedInputArc::Vector::const_iterator iter = tapn.GetInputArcs().begin(); iter != tapn.GetInputArcs().end(); ++iter)
+		{
+			unsigned int t = indices[&(*iter)->OutputTransition()];
+			int p = (*iter)->InputPlace().GetIndex();
+			if(!(*iter)->Interval().IsZeroInfinity()) timeless[p] = false;
+
+			PlaceWeights::iterator it = inputs[t].begin();
+			while(it != inputs[t].end() && it->first != p) ++it;
+			if(it == inputs[t].end()) inputs[t].push_back(std::make_pair(p, 1u));
+			else it->second++;
+			consumers[p].push_back(t);
+		}
+
+		for(TAPN::TransportArc::Vector::const_iterator iter = tapn.GetTransportArcs().begin(); iter != tapn.GetTransportArcs().end(); ++iter)
+		{
+			unsigned int t = indices[&(*iter)->Transition()];
+			int source = (*iter)->Source().GetIndex();
+			int destination = (*iter)->Destination().GetIndex();
+			timeless[source] = false;
+
+			PlaceWeights::iterator it = inputs[t].begin();
+			while(it != inputs[t].end() && it->first != source) ++it;
+			if(it == inputs[t].end()) inputs[t].push_back(std::make_pair(source, 1u));
+			else it->second++;
+			consumers[source].push_back(t);
+			outputs[t].push_back(destination);
+			producers[destination].push_back(t);
+		}
+
+		for(TAPN::OutputArc::Vector::const_iterator iter = tapn.GetOutputArcs().begin(); iter != tapn.GetOutputArcs().end(); ++iter)
+		{
+			unsigned int t = indices[&(*iter)->InputTransition()];
+			int p = (*iter)->OutputPlace().GetIndex();
+			outputs[t].push_back(p);
+			producers[p].push_back(t);
+		}
+
+		for(TAPN::InhibitorArc::Vector::const_iterator iter = tapn.GetInhibitorArcs().begin(); iter != tapn.GetInhibitorArcs().end(); ++iter)
+		{
+			unsigned int t = indices[&(*iter)->OutputTransition()];
+			int p = (*iter)->InputPlace().GetIndex();
+			inhibitors[t].push_back(p);
+			inhibited[p].push_back(t);
+		}
+
+		for(unsigned int t = 0; t < numberOfTransitions; t++)
+		{
+			const TAPN::TimedTransition& transition = *tapn.GetTransitions()[t];
+			timeInsensitive[t] = transition.GetPresetSize() == transition.GetPostsetSize();
+			for(PlaceWeights::const_iterator it = inputs[t].begin(); it != inputs[t].end(); ++it)
+				timeInsensitive[t] = timeInsensitive[t] && timeless[it->first];
+			for(std::vector<int>::const_iterator it = outputs[t].begin(); it != outputs[t].end(); ++it)
+				timeInsensitive[t] = timeInsensitive[t] && timeless[*it];
+		}
+	}
+
+	bool StubbornSet::Compute(const SymbolicMarking& marking, std::vector<bool>& stubborn)
+	{
+		std::fill(tokens.begin(), tokens.end(), 0);
+		for(unsigned int i = 0; i < marking.NumberOfTokens(); i++)
+			tokens[marking.GetTokenPlacement(i)]++;
+
+		unsigned int enabled = 0;
+		int scapegoat;
+		bool isInhibited;
+		for(unsigned int t = 0; t < numberOfTransitions; t++)
+		{
+			if(!IsDisabled(t, scapegoat, isInhibited)) enabled++;
+		}
+
+		unsigned int best = enabled;
+		for(unsigned int t = 0; t < numberOfTransitions && best > 1; t++)
+		{
+			if(!timeInsensitive[t] || IsDisabled(t, scapegoat, isInhibited)) continue;
+
+			unsigned int size;
+			if(Closure(t, candidate, size) && size < best)
+			{
+				best = size;
+				stubborn.swap(candidate);
+			}
+		}
+		return best < enabled;
+	}
+
+	bool StubbornSet::Closure(unsigned int seed, std::vector<bool>& stubborn, unsigned int& enabled)
+	{
+		stubborn.assign(numberOfTransitions, false);
+		stack.clear();
+		enabled = 0;
+		Push(seed, stubborn);
+
+		while(!stack.empty())
+		{
+			unsigned int t = stack.back();
+			stack.pop_back();
+
+			int scapegoat;
+			bool isInhibited;
+			if(IsDisabled(t, scapegoat, isInhibited))
+			{
+				// only the producers (consumers) of the scapegoat place can enable t
+				PushAll(isInhibited ? consumers[scapegoat] : producers[scapegoat], stubborn);
+			}
+			else
+			{
+				// t may be enabled, so everything that can disable it or be disabled by it must be fired too
+				if(!timeInsensitive[t]) return false;
+				enabled++;
+				for(PlaceWeights::const_iterator it = inputs[t].begin(); it != inputs[t].end(); ++it)
+					PushAll(consumers[it->first], stubborn);
+				for(std::vector<int>::const_iterator it = inhibitors[t].begin(); it != inhibitors[t].end(); ++it)
+					PushAll(producers[*it], stubborn);
+				for(std::vector<int>::const_iterator it = outputs[t].begin(); it != outputs[t].end(); ++it)
+					PushAll(inhibited[*it], stubborn);
+			}
+		}
+		return true;
+	}
+
+	// A transition is certainly disabled if an input place holds fewer tokens than it has
+	// arcs to the transition, or an inhibitor place is marked. Otherwise it may be enabled
+	// (its guards are only checked when firing it).
+	bool StubbornSet::IsDisabled(unsigned int transition, int& scapegoat, bool& isInhibited) const
+	{
+		for(PlaceWeights::const_iterator it = inputs[transition].begin(); it != inputs[transition].end(); ++it)
+		{
+			if(tokens[it->first] < it->second)
+			{
+				scapegoat = it->first;
+				isInhibited = false;
+				return true;
+			}
+		}
+		for(std::vector<int>::const_iterator it = inhibitors[transition].begin(); it != inhibitors[transition].end(); ++it)
+		{
+			if(tokens[*it] > 0)
+			{
+				scapegoat = *it;
+				isInhibited = true;
+				return true;
+			}
+		}
+		return false;
+	}
+}
@@ -0,0 +1,66 @@
+#ifndef STUBBORNSET_HPP_
+#define STUBBORNSET_HPP_
+
+#include "../Core/TAPN/TimedArcPetriNet.hpp"
+#include <vector>
+#include <utility>
+
+namespace VerifyTAPN {
+	class SymbolicMarking;
+
+	// Computes stubborn sets for partial-order reduction of reachability queries.
+	//
+	// Only "time-insensitive" transitions may be fired on their own: transitions
+	// that consume from and produce into places where token ages never matter (no
+	// invariant, no outgoing transport arcs and only [0,inf) guards), that do not
+	// change the number of tokens and that do not touch a place of the query. Firing
+	// such a transition neither constrains the zone nor the delays, so it commutes
+	// with any sequence of transitions it does not share input places with.
+	//
+	// The set is closed under the usual stubborn set rules: for a (possibly) enabled
+	// transition, add all transitions consuming from its input places, producing into
+	// its inhibitor places or inhibited by its output places; for a disabled transition,
+	// add the producers of an input place with too few tokens or the consumers of a
+	// marked inhibitor place. If a transition which may be enabled but is not
+	// time-insensitive ends up in the set, no reduction is made.
+	class StubbornSet {
+	public:
+		typedef std::vector< std::pair<int, unsigned int> > PlaceWeights;
+	public:
+		StubbornSet(const TAPN::TimedArcPetriNet& tapn, const std::vector<int>& visiblePlaces);
+		virtual ~StubbornSet() { };
+
+	public:
+		// Marks the transitions to fire in stubborn. Returns false (and fires
+		// everything) if no stubborn set smaller than the enabled transitions exists.
+		bool Compute(const SymbolicMarking& marking, std::vector<bool>& stubborn);
+
+	private:
+		bool Closure(unsigned int seed, std::vector<bool>& stubborn, unsigned int& enabled);
+		bool IsDisabled(unsigned int transition, int& scapegoat, bool& inhibited) const;
+		inline void Push(unsigned int transition, std::vector<bool>& stubborn)
+		{
+			if(!stubborn[transition]) { stubborn[transition] = true; stack.push_back(transition); }
+		};
+		inline void PushAll(const std::vector<unsigned int>& transitions, std::vector<bool>& stubborn)
+		{
+			for(std::vector<unsigned int>::const_iterator it = transitions.begin(); it != transitions.end(); ++it) Push(*it, stubborn);
+		};
+
+	private:
+		unsigned int numberOfTransitions;
+		std::vector<PlaceWeights> inputs;				// per transition: input places (incl. transport sources) with arc count
+		std::vector< std::vector<int> > outputs;		// per transition: output places (incl. transport destinations)
+		std::vector< std::vector<int> > inhibitors;		// per transition: inhibitor places
+		std::vector< std::vector<unsigned int> > consumers;	// per place
+		std::vector< std::vector<unsigned int> > producers;	// per place
+		std::vector< std::vector<unsigned int> > inhibited;	// per place
+		std::vector<bool> timeInsensitive;				// per transition
+
+		std::vector<unsigned int> tokens;				// tokens per place in the current marking
+		std::vector<unsigned int> stack;
+		std::vector<bool> candidate;
+	};
+}
+
+#endif /* STUBBORNSET_HPP_ */
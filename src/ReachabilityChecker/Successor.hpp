@@ -8,15 +8,17 @@ namespace VerifyTAPN
 	class Successor
 	{
 	public:
-		Successor(SymbolicMarking* marking) : marking(marking), traceInfo(0) { };
-		Successor(SymbolicMarking* marking, TraceInfo* traceInfo) : marking(marking), traceInfo(traceInfo) { };
+		Successor(SymbolicMarking* marking, unsigned int transition) : marking(marking), traceInfo(0), transition(transition) { };
+		Successor(SymbolicMarking* marking, TraceInfo* traceInfo, unsigned int transition) : marking(marking), traceInfo(traceInfo), transition(transition) { };
 
 	public:
 		SymbolicMarking* Marking() const { return marking; };
 		TraceInfo* GetTraceInfo() { return traceInfo; };
+		unsigned int TransitionIndex() const { return transition; };
 	private:
 		SymbolicMarking* marking;
 		TraceInfo* traceInfo;
+		unsigned int transition;
 	};
 }
 
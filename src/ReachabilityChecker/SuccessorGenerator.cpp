@@ -2,8 +2,10 @@
 #include "../Core/TAPN/TimedInputArc.hpp"
 #include "../Core/TAPN/Pairing.hpp"
 #include "../Core/SymbolicMarking/SymbolicMarking.hpp"
+#include "../Core/BinaryStream.hpp"
 #include <algorithm>
 #include <set>
+#include <chrono>
 
 namespace VerifyTAPN {
 	void SuccessorGenerator::GenerateDiscreteTransitionsSuccessors(const SymbolicMarking& marking, std::vector<Successor>& succ)
@@ -14,22 +16,72 @@ namespace VerifyTAPN {
 
 		const TAPN::TimedTransition::Vector& transitions = tapn.GetTransitions();
 
+		reduced = stubbornSet != NULL && stubbornSet->Compute(marking, stubborn);
+		cutByKBound = false;
+
 		CollectArcsAndAppropriateTokens(transitions, &marking);
 		GenerateSuccessors(transitions, &marking, succ);
 	}
 
+	// The arcs array and token matrix are still those collected for marking, so only
+	// the transitions outside the stubborn set have to be fired.
+	void SuccessorGenerator::GenerateRemainingSuccessors(const SymbolicMarking& marking, std::vector<Successor>& succ)
+	{
+		assert(reduced);
+		stubborn.flip();
+		cutByKBound = false;
+		GenerateSuccessors(tapn.GetTransitions(), &marking, succ);
+		reduced = false;
+	}
+
+	void SuccessorGenerator::GenerateTransitionSuccessors(const SymbolicMarking& marking, unsigned int transition, std::vector<Successor>& succ)
+	{
+		const TAPN::TimedTransition& t = *tapn.GetTransitions()[transition];
+		unsigned int currInputArcIdx = firstArc[transition];
+		memset(arcsArray + currInputArcIdx, 0, t.GetPresetSize() * sizeof (arcsArray[0]));
+		reduced = false;
+		cutByKBound = false;
+
+		CollectArcsAndAppropriateTokens(t, &marking, currInputArcIdx);
+		GenerateSuccessors(t, firstArc[transition], transition, &marking, succ);
+	}
+
+	void SuccessorGenerator::GenerateEnablingZones(const SymbolicMarking& marking, std::vector<SymbolicMarking*>& zones)
+	{
+		std::vector<TransitionStatistics> saved(transitionStatistics, transitionStatistics + numberOfTransitions);
+		std::vector<SymbolicMarking*>* previous = enablingZones;
+		std::vector<Successor> none;
+		enablingZones = &zones;
+		zonesOnly = true;
+		GenerateDiscreteTransitionsSuccessors(marking, none);
+		zonesOnly = false;
+		enablingZones = previous;
+		std::copy(saved.begin(), saved.end(), transitionStatistics);
+		assert(none.empty());
+	}
+
     void SuccessorGenerator::UpdateArcInfo(const SymbolicMarking *marking, int currInputPlaceIndex, const TAPN::TimeInterval & ti, unsigned int & currInputArcIdx)
     {
         unsigned int nTokensFromCurrInputPlace = 0;
-        for(unsigned int i = 0; i < marking->NumberOfTokens(); i++)
+        unsigned int remaining = marking->NumberOfTokensInPlace(currInputPlaceIndex); // stop scanning once all of them are seen
+        for(unsigned int i = 0; remaining > 0 && i < marking->NumberOfTokens(); i++)
 		{
 			int placeIndex = marking->GetTokenPlacement(i);
 
 
 			if(placeIndex == currInputPlaceIndex)
 			{
+				remaining--;
 				bool potentiallyUsable = marking->PotentiallySatisfies(i, ti);
 
+				// Firing with a token equivalent to one already collected only gives a symmetric successor.
+				// With several arcs from the place, the transition may need both tokens, so keep them all.
+				if(potentiallyUsable && singleArcFromPlace[currInputArcIdx])
+				{
+					for(unsigned int j = 0; j < nTokensFromCurrInputPlace && potentiallyUsable; j++)
+						potentiallyUsable = !marking->AreTokensEquivalent(i, tokenIndices->at_element(currInputArcIdx, j));
+				}
+
 				if(potentiallyUsable)
 				{
 					assert(currInputArcIdx <= nInputArcs);
@@ -43,6 +95,36 @@ namespace VerifyTAPN {
 		}
     }
 
+	void SuccessorGenerator::InitSingleArcFromPlace()
+	{
+		const TAPN::TimedTransition::Vector& transitions = tapn.GetTransitions();
+		for(TAPN::TimedTransition::Vector::const_iterator iter = transitions.begin(); iter != transitions.end(); ++iter)
+		{
+			// same order as in CollectArcsAndAppropriateTokens
+			std::vector<int> places;
+			const TAPN::TransportArc::WeakPtrVector& transportArcs = (*iter)->GetTransportArcs();
+			for(TAPN::TransportArc::WeakPtrVector::const_iterator arc = transportArcs.begin(); arc != transportArcs.end(); ++arc)
+				places.push_back(tapn.GetPlaceIndex(arc->lock()->Source()));
+			const TAPN::TimedInputArc::WeakPtrVector& preset = (*iter)->GetPreset();
+			for(TAPN::TimedInputArc::WeakPtrVector::const_iterator arc = preset.begin(); arc != preset.end(); ++arc)
+				places.push_back(tapn.GetPlaceIndex(arc->lock()->InputPlace()));
+
+			for(std::vector<int>::const_iterator place = places.begin(); place != places.end(); ++place)
+				singleArcFromPlace.push_back(std::count(places.begin(), places.end(), *place) == 1);
+		}
+	}
+
+	void SuccessorGenerator::InitFirstArc()
+	{
+		unsigned int arc = 0;
+		const TAPN::TimedTransition::Vector& transitions = tapn.GetTransitions();
+		for(TAPN::TimedTransition::Vector::const_iterator iter = transitions.begin(); iter != transitions.end(); ++iter)
+		{
+			firstArc.push_back(arc);
+			arc += (*iter)->GetPresetSize();
+		}
+	}
+
 	// Collects the number of tokens of potentially appropriate age for each input into arcsArray.
 	// Note that arcs array should be sorted by transition. Further, if a token is potentially of
 	// appropriate age we add the token index to the tokenIndices matrix for use when generating successors.
@@ -51,28 +133,31 @@ namespace VerifyTAPN {
 		unsigned int currInputArcIdx = 0;
 
 		for(TAPN::TimedTransition::Vector::const_iterator iter = transitions.begin(); iter != transitions.end(); ++iter)
+			CollectArcsAndAppropriateTokens(*(*iter), marking, currInputArcIdx);
+	}
+
+	void SuccessorGenerator::CollectArcsAndAppropriateTokens(const TAPN::TimedTransition& transition, const SymbolicMarking* marking, unsigned int& currInputArcIdx)
+	{
+		const TAPN::TransportArc::WeakPtrVector& transportArcs = transition.GetTransportArcs();
+		for(TAPN::TransportArc::WeakPtrVector::const_iterator presetIter = transportArcs.begin(); presetIter != transportArcs.end(); ++presetIter)
 		{
-			const TAPN::TransportArc::WeakPtrVector& transportArcs = (*iter)->GetTransportArcs();
-			for(TAPN::TransportArc::WeakPtrVector::const_iterator presetIter = transportArcs.begin(); presetIter != transportArcs.end(); ++presetIter)
-			{
-				boost::shared_ptr<TAPN::TransportArc> ta = (*presetIter).lock();
-				const TAPN::TimeInterval& ti = ta->Interval();
-				int currInputPlaceIndex = tapn.GetPlaceIndex(ta->Source());
+			boost::shared_ptr<TAPN::TransportArc> ta = (*presetIter).lock();
+			const TAPN::TimeInterval& ti = ta->Interval();
+			int currInputPlaceIndex = tapn.GetPlaceIndex(ta->Source());
 
-				UpdateArcInfo(marking, currInputPlaceIndex, ti, currInputArcIdx);
-				currInputArcIdx++;
-			}
+			UpdateArcInfo(marking, currInputPlaceIndex, ti, currInputArcIdx);
+			currInputArcIdx++;
+		}
 
-			const TAPN::TimedInputArc::WeakPtrVector& preset = (*iter)->GetPreset();
-			for(TAPN::TimedInputArc::WeakPtrVector::const_iterator presetIter = preset.begin(); presetIter != preset.end(); ++presetIter)
-			{
-				boost::shared_ptr<TAPN::TimedInputArc> ia = (*presetIter).lock();
-				const TAPN::TimeInterval& ti = ia->Interval();
-				int currInputPlaceIndex = tapn.GetPlaceIndex(ia->InputPlace());
+		const TAPN::TimedInputArc::WeakPtrVector& preset = transition.GetPreset();
+		for(TAPN::TimedInputArc::WeakPtrVector::const_iterator presetIter = preset.begin(); presetIter != preset.end(); ++presetIter)
+		{
+			boost::shared_ptr<TAPN::TimedInputArc> ia = (*presetIter).lock();
+			const TAPN::TimeInterval& ti = ia->Interval();
+			int currInputPlaceIndex = tapn.GetPlaceIndex(ia->InputPlace());
 
-				UpdateArcInfo(marking, currInputPlaceIndex, ti, currInputArcIdx);
-				currInputArcIdx++;
-			}
+			UpdateArcInfo(marking, currInputPlaceIndex, ti, currInputArcIdx);
+			currInputArcIdx++;
 		}
 	}
 
@@ -84,48 +169,59 @@ namespace VerifyTAPN {
 		int realCurrentTransitionIndex = 0;
 		for(TAPN::TimedTransition::Vector::const_iterator iter = transitions.begin(); iter != transitions.end(); ++iter)
 		{
-			unsigned int presetSize = (*iter)->GetPresetSize();
-			if(IsTransitionEnabled(*(*iter),marking,currentTransitionIndex, presetSize))
+			if(!reduced || stubborn[realCurrentTransitionIndex])
+				GenerateSuccessors(*(*iter), currentTransitionIndex, realCurrentTransitionIndex, marking, succ);
+
+			realCurrentTransitionIndex++;
+			currentTransitionIndex += (*iter)->GetPresetSize(); // jump to next start of next transition in arcsArray
+		}
+	}
+
+	void SuccessorGenerator::GenerateSuccessors(const TAPN::TimedTransition& transition, unsigned int currentTransitionIndex, unsigned int realCurrentTransitionIndex, const SymbolicMarking* marking, std::vector<Successor>& succ)
+	{
+		unsigned int presetSize = transition.GetPresetSize();
+		if(!IsTransitionEnabled(transition, marking, currentTransitionIndex, presetSize))
+			return;
+
+		// The indicesOfCurrentPermutation array stores the column indices
+		// into the token matrix for the current permutation of input tokens.
+		// I.e. it is used to select which tokens to consume when firing the transition.
+		unsigned int indicesOfCurrentPermutation[presetSize];
+		for(unsigned int i = 0; i < presetSize; ++i)
+			indicesOfCurrentPermutation[i] = 0;
+
+		bool done = false;
+		TransitionStatistics& statistics = transitionStatistics[realCurrentTransitionIndex];
+		statistics.enabled++;
+		bool timed = options.GetStatisticsFormat() != NO_STATISTICS;
+		std::chrono::steady_clock::time_point start;
+		if(timed) start = std::chrono::steady_clock::now();
+		while(true)
+		{
+
+			GenerateSuccessorForCurrentPermutation(transition, indicesOfCurrentPermutation, currentTransitionIndex, presetSize, marking, succ, realCurrentTransitionIndex);
+
+			// Generate next permutation of input tokens
+			int j = presetSize - 1;
+			if (j<0) { break; }    
+
+			while(true)
 			{
-				// The indicesOfCurrentPermutation array stores the column indices
-				// into the token matrix for the current permutation of input tokens.
-				// I.e. it is used to select which tokens to consume when firing the transition.
-				unsigned int indicesOfCurrentPermutation[presetSize];
-				for(unsigned int i = 0; i < presetSize; ++i)
-					indicesOfCurrentPermutation[i] = 0;
-
-				bool done = false;
-				transitionStatistics[realCurrentTransitionIndex]++;
-				while(true)
+				indicesOfCurrentPermutation[j] += 1;
+				if(indicesOfCurrentPermutation[j] < arcsArray[currentTransitionIndex+j])
+					break;
+				indicesOfCurrentPermutation[j] = 0;
+				j -= 1;
+				if(j < 0)
 				{
-
-					GenerateSuccessorForCurrentPermutation(*(*iter), indicesOfCurrentPermutation, currentTransitionIndex, presetSize, marking, succ);
-
-					// Generate next permutation of input tokens
-					int j = presetSize - 1;
-					if (j<0) { break; }    
-
-					while(true)
-					{
-						indicesOfCurrentPermutation[j] += 1;
-						if(indicesOfCurrentPermutation[j] < arcsArray[currentTransitionIndex+j])
-							break;
-						indicesOfCurrentPermutation[j] = 0;
-						j -= 1;
-						if(j < 0)
-						{
-							done = true;
-							break;
-						}
-					}
-					if(done)
-						break;
+					done = true;
+					break;
 				}
 			}
-
-			realCurrentTransitionIndex++;
-			currentTransitionIndex += presetSize; // jump to next start of next transition in arcsArray
+			if(done)
+				break;
 		}
+		if(timed) statistics.nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
 	}
 
 	// After the input arcs and tokens have been collected
@@ -138,13 +234,8 @@ namespace VerifyTAPN {
 		for(TAPN::InhibitorArc::WeakPtrVector::const_iterator iter = inhibitorArcs.begin(); iter != inhibitorArcs.end(); ++iter)
 		{
 			boost::shared_ptr<TAPN::InhibitorArc> ia = iter->lock();
-			int sourcePlaceIndex = ia->InputPlace().GetIndex();
-
-			for(unsigned int i = 0; i < marking->NumberOfTokens(); i++)
-			{
-				if(marking->GetTokenPlacement(i) == sourcePlaceIndex)
-					return false;
-			}
+			if(marking->NumberOfTokensInPlace(ia->InputPlace().GetIndex()) > 0)
+				return false;
 		}
 
 		for(unsigned int i = currTransitionIndex; i < currTransitionIndex + presetSize; ++i)
@@ -155,44 +246,99 @@ namespace VerifyTAPN {
 		return true;
 	}
 
+	// Each token was only checked against its own guard when it was collected. Check on the parent
+	// zone that every pair of chosen tokens can satisfy their guards at the same time, which
+	// rejects many permutations before the marking is cloned and constrained.
+	bool SuccessorGenerator::GuardsPotentiallySatisfiable(const TAPN::TimedTransition& transition, const unsigned int* currentPermutationindices, const unsigned int currentTransitionIndex, const unsigned int presetSize, const SymbolicMarking* marking) const
+	{
+		unsigned int nTransportArcs = transition.NumberOfTransportArcs();
+		for(unsigned int i = 0; i < presetSize; ++i)
+		{
+			int token = tokenIndices->at_element(currentTransitionIndex+i, currentPermutationindices[i]);
+			const TAPN::TimeInterval& interval = i < nTransportArcs ? transition.GetTransportArcs()[i].lock()->Interval() : transition.GetPreset()[i-nTransportArcs].lock()->Interval();
+			for(unsigned int j = i+1; j < presetSize; ++j)
+			{
+				int other = tokenIndices->at_element(currentTransitionIndex+j, currentPermutationindices[j]);
+				if(other == token) continue;
+				const TAPN::TimeInterval& otherInterval = j < nTransportArcs ? transition.GetTransportArcs()[j].lock()->Interval() : transition.GetPreset()[j-nTransportArcs].lock()->Interval();
+				if(!marking->PotentiallySatisfies(token, interval, other, otherInterval))
+					return false;
+			}
+		}
+		return true;
+	}
+
 	// Generates a successor node for the current permutation of input tokens
-	void SuccessorGenerator::GenerateSuccessorForCurrentPermutation(const TAPN::TimedTransition& transition, const unsigned int* currentPermutationindices, const unsigned int currentTransitionIndex, const unsigned int presetSize, const SymbolicMarking* marking, std::vector<Successor>& succ)
+	void SuccessorGenerator::GenerateSuccessorForCurrentPermutation(const TAPN::TimedTransition& transition, const unsigned int* currentPermutationindices, const unsigned int currentTransitionIndex, const unsigned int presetSize, const SymbolicMarking* marking, std::vector<Successor>& succ, unsigned int transitionIndex)
 	{
+		TransitionStatistics& statistics = transitionStatistics[transitionIndex];
 		unsigned int kBound = options.GetKBound();
 		bool trace = options.GetTrace() != NONE;
 
 		const Pairing& pairing = tapn.GetPairing(transition);
 		const TAPN::TimedInputArc::WeakPtrVector& preset = transition.GetPreset();
 		std::set<int> tokensToRemove; // sets are sorted internally in ascending order. THIS MUST BE THE CASE OR THE CODE WONT WORK!
+		statistics.generated++;
+		if(presetSize > 1 && !GuardsPotentiallySatisfiable(transition, currentPermutationindices, currentTransitionIndex, presetSize, marking))
+		{
+			statistics.emptyZone++;
+			return;
+		}
 		SymbolicMarking* next = factory.Clone(*marking);
 
+		// constrain the dbm with the guards of all input arcs at once
+		guards.clear();
 		for(unsigned int i = 0; i < transition.NumberOfTransportArcs(); ++i)
 		{
-			boost::shared_ptr<TAPN::TransportArc> ta = transition.GetTransportArcs()[i].lock();
-			const TAPN::TimeInterval& ti = ta->Interval();
-
 			int tokenIndex = tokenIndices->at_element(currentTransitionIndex+i, currentPermutationindices[i]);
-			int outputPlaceIndex = tapn.GetPlaceIndex(ta->Destination());
+			guards.push_back(std::make_pair(tokenIndex, &transition.GetTransportArcs()[i].lock()->Interval()));
+		}
 
-			// constrain dbm with the guard of the input arc
-			next->Constrain(tokenIndex, ti);
-			next->MoveToken(tokenIndex, outputPlaceIndex);
+		int offset = transition.NumberOfTransportArcs();
+		for(unsigned int i = 0; i < transition.NumberOfInputArcs(); ++i)
+		{
+			int tokenIndex = tokenIndices->at_element(currentTransitionIndex+offset+i, currentPermutationindices[offset+i]);
+			guards.push_back(std::make_pair(tokenIndex, &preset[i].lock()->Interval()));
+		}
+
+		next->Constrain(guards);
+		if(next->IsEmpty())
+		{
+			statistics.emptyZone++;
+			factory.Recycle(next);
+			return;
+		}
 
-			if(next->IsEmpty())
+		if(enablingZones != NULL)
+		{
+			// transported tokens must also satisfy the invariant of their destination
+			SymbolicMarking* enabling = factory.Clone(*next);
+			for(unsigned int i = 0; i < transition.NumberOfTransportArcs(); ++i)
 			{
-				delete next;
-				return;
+				int tokenIndex = tokenIndices->at_element(currentTransitionIndex+i, currentPermutationindices[i]);
+				enabling->Constrain(tokenIndex, transition.GetTransportArcs()[i].lock()->Destination().GetInvariant());
 			}
+			if(enabling->IsEmpty()) factory.Recycle(enabling);
+			else enablingZones->push_back(enabling);
+		}
+		if(zonesOnly)
+		{
+			factory.Recycle(next);
+			return;
+		}
 
+		for(unsigned int i = 0; i < transition.NumberOfTransportArcs(); ++i)
+		{
+			boost::shared_ptr<TAPN::TransportArc> ta = transition.GetTransportArcs()[i].lock();
+			int tokenIndex = tokenIndices->at_element(currentTransitionIndex+i, currentPermutationindices[i]);
+			next->MoveToken(tokenIndex, tapn.GetPlaceIndex(ta->Destination()));
 		}
 
-		int offset = transition.NumberOfTransportArcs();
 		// move all tokens that are currently in the net
 		for(unsigned int i = 0; i < transition.NumberOfInputArcs(); ++i)
 		{
 			boost::shared_ptr<TAPN::TimedInputArc> inputArc = preset[i].lock();
 			int inputPlace = tapn.GetPlaceIndex(inputArc->InputPlace());
-			const TAPN::TimeInterval& ti = inputArc->Interval();
 			const std::list<int>& outputPlaces = pairing.GetOutputPlacesFor(inputPlace);
 
 			// only BOTTOM is allowed to have more than 1 associated output place
@@ -204,19 +350,10 @@ namespace VerifyTAPN {
 				int tokenIndex = tokenIndices->at_element(currentTransitionIndex+offset+i, currentPermutationindices[offset+i]);
 				int outputPlaceIndex = *opIter;
 
-				// constrain dbm with the guard of the input arc
-				next->Constrain(tokenIndex, ti);
-
 				if(outputPlaceIndex == TAPN::TimedPlace::BottomIndex())
 					tokensToRemove.insert(tokenIndex);
 				else
 					next->MoveToken(tokenIndex, outputPlaceIndex);
-
-				if(next->IsEmpty())
-				{
-					delete next;
-					return;
-				}
 			}
 		}
 
@@ -246,24 +383,22 @@ namespace VerifyTAPN {
 			// Perform under-approximation in case the net is not k-bounded.
 			// I.e. only allow up to k tokens in a given marking.
 			if(tokensInSuccessor > kBound) {
-				delete next;
+				statistics.kBoundCut++;
+				cutByKBound = true;
+				factory.Recycle(next);
 				return;
 			}
 
 			next->AddTokens(outputPlaces);
 		}
 
-		for(unsigned int i = 0; i < next->NumberOfTokens(); i++)
+		next->ConstrainInvariants();
+		if(next->IsEmpty())
 		{
-			const TAPN::TimeInvariant& invariant = tapn.GetPlace(next->GetTokenPlacement(i)).GetInvariant();
-			next->Constrain(i, invariant);
-
-			if(next->IsEmpty())
-			{
-				maxUsedTokens = prevMaxTokens; // This wasn't really a valid successor, so we "roll back" any potential update to the max used tokens counter.
-				delete next;
-				return;
-			}
+			maxUsedTokens = prevMaxTokens; // This wasn't really a valid successor, so we "roll back" any potential update to the max used tokens counter.
+			statistics.emptyZone++;
+			factory.Recycle(next);
+			return;
 		}
 
 
@@ -342,9 +477,9 @@ namespace VerifyTAPN {
 
 			traceInfo->SetInvariants(invariants);
 			traceInfo->SetTransitionFiringMapping(mapping);
-			succ.push_back(Successor(next, traceInfo));
+			succ.push_back(Successor(next, traceInfo, transitionIndex));
 		}else{
-			succ.push_back(Successor(next));
+			succ.push_back(Successor(next, transitionIndex));
 		}
 		tokensToRemove.clear();
 	}
@@ -403,7 +538,7 @@ namespace VerifyTAPN {
 		out << "\nTransitions Array:\n";
 				out << "------------------\n";
 		for(int j =0;j< numberOfTransitions;j++){
-			out << j << ": " << transitionStatistics[j] << "\n";
+			out << j << ": " << transitionStatistics[j].enabled << "\n";
 		}
 
 		out << "\n\nToken Indices:\n";
@@ -417,13 +552,47 @@ namespace VerifyTAPN {
 		for (int i=0;i<tapn.GetNumberOfTransitions();i++) {
 			if ((i) % 6 == 0) {
 				out << std::endl;
-				out << "<" << tapn.GetTransitions()[i]->GetName() << ":" << transitionStatistics[i] << ">";
+				out << "<" << tapn.GetTransitions()[i]->GetName() << ":" << transitionStatistics[i].enabled << ">";
 			}
 			else {
-				out << " <"  <<tapn.GetTransitions()[i]->GetName() << ":" << transitionStatistics[i] << ">";
+				out << " <"  <<tapn.GetTransitions()[i]->GetName() << ":" << transitionStatistics[i].enabled << ">";
 			}
 		}
 		out << std::endl;
 		out << std::endl;
 	}
+
+	void SuccessorGenerator::ExportTransitionStatistics(std::ostream& out, StatisticsFormat format) const {
+		if(format == CSV_STATISTICS)
+			out << "transition,enabled,generated,empty_zone,k_bound_cut,subsumed,stored,time_ms" << std::endl;
+		else
+			out << "[" << std::endl;
+
+		for (int i=0;i<tapn.GetNumberOfTransitions();i++) {
+			const TransitionStatistics& s = transitionStatistics[i];
+			const std::string& name = tapn.GetTransitions()[i]->GetName();
+			if(format == CSV_STATISTICS) {
+				out << name << "," << s.enabled << "," << s.generated << "," << s.emptyZone << "," << s.kBoundCut
+					<< "," << s.subsumed << "," << s.stored << "," << s.nanoseconds / 1e6 << std::endl;
+			}
+			else {
+				out << "  {\"transition\":\"" << name << "\",\"enabled\":" << s.enabled << ",\"generated\":" << s.generated
+					<< ",\"empty_zone\":" << s.emptyZone << ",\"k_bound_cut\":" << s.kBoundCut << ",\"subsumed\":" << s.subsumed
+					<< ",\"stored\":" << s.stored << ",\"time_ms\":" << s.nanoseconds / 1e6 << "}" << (i+1 < tapn.GetNumberOfTransitions() ? "," : "") << std::endl;
+			}
+		}
+
+		if(format == JSON_STATISTICS)
+			out << "]" << std::endl;
+	}
+
+	void SuccessorGenerator::Save(BinaryWriter& out) const {
+		out.Write(maxUsedTokens);
+		out.WriteArray(transitionStatistics, numberOfTransitions * sizeof (transitionStatistics[0]));
+	}
+
+	void SuccessorGenerator::Load(BinaryReader& in) {
+		maxUsedTokens = in.Read<unsigned int>();
+		in.ReadArray(transitionStatistics, numberOfTransitions * sizeof (transitionStatistics[0]));
+	}
 }
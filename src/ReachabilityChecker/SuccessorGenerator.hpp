@@ -5,6 +5,7 @@
 #include "Successor.hpp"
 #include "../Core/VerificationOptions.hpp"
 #include "../Core/SymbolicMarking/MarkingFactory.hpp"
+#include "StubbornSet.hpp"
 
 #include <vector>
 #include <boost/smart_ptr.hpp>
@@ -13,14 +14,31 @@
 
 namespace VerifyTAPN {
 	class SymbolicMarking;
+	class BinaryWriter;
+	class BinaryReader;
+
+	// Per-transition counters. A token permutation that is tried either ends
+	// in an empty zone, is cut by the k-bound, or yields a successor which the
+	// passed/waiting list then either subsumes or stores.
+	struct TransitionStatistics {
+		long long enabled;		// markings in which the transition was enabled
+		long long generated;	// token permutations fired
+		long long emptyZone;	// firings whose guards or invariants gave an empty zone
+		long long kBoundCut;	// firings needing more than k tokens
+		long long subsumed;		// successors already covered by the passed/waiting list
+		long long stored;		// successors added to the passed/waiting list
+		long long nanoseconds;	// time spent firing the transition (only measured when exporting)
+	};
 
 	class SuccessorGenerator {
 	public:
 	    SuccessorGenerator(const TAPN::TimedArcPetriNet & tapn, const MarkingFactory & factory, const VerificationOptions & options, unsigned int tokensInInitialMarking)
-	    :tapn(tapn), factory(factory), arcsArray(), nInputArcs(tapn.GetNumberOfConsumingArcs()), transitionStatistics(), numberOfTransitions(tapn.GetNumberOfTransitions()), options(options), tokenIndices(), maxUsedTokens(tokensInInitialMarking)
+	    :tapn(tapn), factory(factory), arcsArray(), nInputArcs(tapn.GetNumberOfConsumingArcs()), transitionStatistics(), numberOfTransitions(tapn.GetNumberOfTransitions()), options(options), tokenIndices(), maxUsedTokens(tokensInInitialMarking), stubbornSet(NULL), stubborn(), reduced(false), cutByKBound(false), enablingZones(NULL), zonesOnly(false), singleArcFromPlace(), firstArc(), guards()
 	    {
 	        arcsArray = new unsigned [nInputArcs];
-	        transitionStatistics = new unsigned [numberOfTransitions];
+	        InitSingleArcFromPlace();
+	        InitFirstArc();
+	        transitionStatistics = new TransitionStatistics [numberOfTransitions];
 	        tokenIndices = new boost::numeric::ublas::matrix<int>(nInputArcs, options.GetKBound());
 	        ClearTransitionsArray();
 	    }
@@ -31,14 +49,36 @@ namespace VerifyTAPN {
 	        delete [] arcsArray;
 	        delete tokenIndices;
 		delete [] transitionStatistics;
+		delete stubbornSet;
 	    }
 
 	    ;
 	public:
 	    void GenerateDiscreteTransitionsSuccessors(const SymbolicMarking & marking, std::vector<VerifyTAPN::Successor> & succ);
+	    // Fires the transitions left out by the last (reduced) call to GenerateDiscreteTransitionsSuccessors.
+	    void GenerateRemainingSuccessors(const SymbolicMarking & marking, std::vector<VerifyTAPN::Successor> & succ);
+	    void EnablePartialOrderReduction(const std::vector<int> & visiblePlaces)
+	    {
+	    	delete stubbornSet;
+	    	stubbornSet = new StubbornSet(tapn, visiblePlaces);
+	    }
+
+	    // Fires only the given transition. No state is kept between calls, so the
+	    // transitions of several markings can be fired interleaved.
+	    void GenerateTransitionSuccessors(const SymbolicMarking & marking, unsigned int transition, std::vector<VerifyTAPN::Successor> & succ);
+	    // Adds to zones, for each firing, the zone of the marking in which it is enabled as a
+	    // constrained clone of the marking, without building the successors. The caller
+	    // releases them. The transition statistics are left untouched.
+	    void GenerateEnablingZones(const SymbolicMarking & marking, std::vector<SymbolicMarking*> & zones);
+
+	    inline bool IsReduced() const { return reduced; }
+	    inline bool CutByKBound() const { return cutByKBound; } // the last call dropped a successor with more than k tokens
 	public:
 	    void Print(std::ostream & out) const;
 	    void PrintTransitionStatistics(std::ostream & out) const;
+	    void ExportTransitionStatistics(std::ostream & out, StatisticsFormat format) const;
+	    void Save(BinaryWriter & out) const;
+	    void Load(BinaryReader & in);
 	public:
 	    inline void ClearAll()
 	    {
@@ -64,13 +104,24 @@ namespace VerifyTAPN {
 	    {
 	    	return maxUsedTokens;
 	    }
+
+	    inline void RecordSuccessorAdded(unsigned int transition, bool added)
+	    {
+	    	if(added) transitionStatistics[transition].stored++;
+	    	else transitionStatistics[transition].subsumed++;
+	    }
 	private:
 	    void CollectArcsAndAppropriateTokens(const TAPN::TimedTransition::Vector & transitions, const SymbolicMarking *marking);
+	    void CollectArcsAndAppropriateTokens(const TAPN::TimedTransition & transition, const SymbolicMarking *marking, unsigned int & currInputArcIdx);
 	    void GenerateSuccessors(const TAPN::TimedTransition::Vector & transitions, const SymbolicMarking *marking, std::vector<Successor> & succ);
-	    void GenerateSuccessorForCurrentPermutation(const TAPN::TimedTransition & currTransition, const unsigned int *indices, const unsigned int currTransitionIndex, const unsigned int presetSize, const SymbolicMarking *marking, std::vector<Successor> & succ);
+	    void GenerateSuccessors(const TAPN::TimedTransition & transition, unsigned int currTransitionIndex, unsigned int transitionIndex, const SymbolicMarking *marking, std::vector<Successor> & succ);
+	    void GenerateSuccessorForCurrentPermutation(const TAPN::TimedTransition & currTransition, const unsigned int *indices, const unsigned int currTransitionIndex, const unsigned int presetSize, const SymbolicMarking *marking, std::vector<Successor> & succ, unsigned int transitionIndex);
 	private:
+	    bool GuardsPotentiallySatisfiable(const TAPN::TimedTransition& transition, const unsigned int* indices, const unsigned int currTransitionIndex, const unsigned int presetSize, const SymbolicMarking* marking) const;
 	    bool IsTransitionEnabled(const TAPN::TimedTransition& transition, const SymbolicMarking* marking, unsigned int currTransitionIndex, unsigned int presetSize) const;
 	    void UpdateArcInfo(const SymbolicMarking *marking, int currInputPlaceIndex, const TAPN::TimeInterval & ti, unsigned int & currInputArcIdx);
+	    void InitSingleArcFromPlace();
+	    void InitFirstArc();
 
 	    void MakeIdentity(IndirectionTable& mapping, unsigned int size) const;
 	    void UpdateTraceMapping(IndirectionTable& mapping, unsigned int tokenToRemove) const;
@@ -79,11 +130,20 @@ namespace VerifyTAPN {
 		const MarkingFactory& factory;
 		unsigned int* arcsArray;
 		unsigned int nInputArcs;
-		unsigned int* transitionStatistics;
+		TransitionStatistics* transitionStatistics;
 		const int numberOfTransitions;
 		const VerificationOptions& options;
 		boost::numeric::ublas::matrix<int>* tokenIndices;
 		unsigned int maxUsedTokens;
+		StubbornSet* stubbornSet;
+		std::vector<bool> stubborn;
+		bool reduced;
+		bool cutByKBound;
+		std::vector<SymbolicMarking*>* enablingZones;
+		bool zonesOnly; // stop each firing once its enabling zone is collected
+		std::vector<bool> singleArcFromPlace; // per consuming arc: no other arc of the transition consumes from the same place
+		std::vector<unsigned int> firstArc; // per transition: index of its first consuming arc in arcsArray
+		AbstractMarking::GuardList guards; // reused for every successor
 	};
 
 	inline std::ostream& operator<<(std::ostream& out, const VerifyTAPN::SuccessorGenerator& succGen)
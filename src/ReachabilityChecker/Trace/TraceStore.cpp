@@ -2,6 +2,7 @@
 #include "EntrySolver.hpp"
 #include "../../Core/SymbolicMarking/SymbolicMarking.hpp"
 #include "../../Core/TAPNParser/util.hpp"
+#include "../../Core/BinaryStream.hpp"
 
 #include <rapidxml.hpp>
 
@@ -206,4 +207,104 @@ namespace VerifyTAPN
 
 		std::cerr << doc.first_node();
 	}
+
+	void WriteTimeInvariant(BinaryWriter& out, const TAPN::TimeInvariant& invariant)
+	{
+		out.Write(invariant.IsBoundStrict());
+		out.Write(invariant.GetBound());
+	}
+
+	TAPN::TimeInvariant ReadTimeInvariant(BinaryReader& in)
+	{
+		bool strict = in.Read<bool>();
+		return TAPN::TimeInvariant(strict, in.Read<int>());
+	}
+
+	// Only the data recorded during the search is saved; the original
+	// mapping is computed when the trace is output.
+	void WriteTraceInfo(BinaryWriter& out, const TraceInfo& traceInfo)
+	{
+		out.Write(traceInfo.PreviousStateId());
+		out.Write(traceInfo.TransitionIndex());
+		out.Write(traceInfo.StateId());
+
+		const std::vector<Participant>& participants = traceInfo.Participants();
+		out.Write<unsigned int>(participants.size());
+		for(std::vector<Participant>::const_iterator it = participants.begin(); it != participants.end(); ++it)
+		{
+			const TAPN::TimeInterval& ti = it->GetTimeInterval();
+			out.Write(it->TokenIndex());
+			out.Write(ti.IsLowerBoundStrict());
+			out.Write(ti.GetLowerBound());
+			out.Write(ti.GetUpperBound());
+			out.Write(ti.IsUpperBoundStrict());
+			out.Write(it->PlacementAfterFiring());
+			out.Write(it->GetArcType());
+		}
+
+		traceInfo.GetSymmetricMapping().Write(out);
+		traceInfo.GetTransitionFiringMapping().Write(out);
+
+		const std::vector<TraceInfo::Invariant>& invariants = traceInfo.GetInvariants();
+		out.Write<unsigned int>(invariants.size());
+		for(std::vector<TraceInfo::Invariant>::const_iterator it = invariants.begin(); it != invariants.end(); ++it)
+		{
+			out.Write(it->first);
+			WriteTimeInvariant(out, it->second);
+		}
+	}
+
+	TraceInfo* ReadTraceInfo(BinaryReader& in)
+	{
+		id_type prevState = in.Read<id_type>();
+		int transitionIndex = in.Read<int>();
+		TraceInfo* traceInfo = new TraceInfo(prevState, transitionIndex, in.Read<id_type>());
+
+		unsigned int nParticipants = in.Read<unsigned int>();
+		for(unsigned int i = 0; i < nParticipants; i++)
+		{
+			int tokenIndex = in.Read<int>();
+			bool leftStrict = in.Read<bool>();
+			int lowerBound = in.Read<int>();
+			int upperBound = in.Read<int>();
+			bool rightStrict = in.Read<bool>();
+			int placementAfterFiring = in.Read<int>();
+			ArcType arcType = in.Read<ArcType>();
+			traceInfo->AddParticipant(Participant(tokenIndex, TAPN::TimeInterval(leftStrict, lowerBound, upperBound, rightStrict), placementAfterFiring, arcType));
+		}
+
+		traceInfo->GetSymmetricMapping().Read(in);
+		IndirectionTable transitionFiringMapping;
+		transitionFiringMapping.Read(in);
+		traceInfo->SetTransitionFiringMapping(transitionFiringMapping);
+
+		std::vector<TraceInfo::Invariant> invariants;
+		unsigned int nInvariants = in.Read<unsigned int>();
+		for(unsigned int i = 0; i < nInvariants; i++)
+		{
+			unsigned int token = in.Read<unsigned int>();
+			invariants.push_back(TraceInfo::Invariant(token, ReadTimeInvariant(in)));
+		}
+		traceInfo->SetInvariants(invariants);
+		return traceInfo;
+	}
+
+	void TraceStore::Save(BinaryWriter& out) const
+	{
+		out.Write<long long>(store.size());
+		for(HashMap::const_iterator it = store.begin(); it != store.end(); it++)
+		{
+			WriteTraceInfo(out, *it->second);
+		}
+	}
+
+	void TraceStore::Load(BinaryReader& in)
+	{
+		long long size = in.Read<long long>();
+		for(long long i = 0; i < size; i++)
+		{
+			TraceInfo* traceInfo = ReadTraceInfo(in);
+			Save(traceInfo->StateId(), traceInfo);
+		}
+	}
 }
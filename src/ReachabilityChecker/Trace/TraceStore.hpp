@@ -14,6 +14,8 @@
 namespace VerifyTAPN
 {
 	class SymbolicMarking;
+	class BinaryWriter;
+	class BinaryReader;
 
 	inline ConcreteMarking CreateConcreteInitialMarking(SymbolicMarking* initialMarking, unsigned int kbound, const TAPN::TimedArcPetriNet& tapn)
 	{
@@ -71,6 +73,8 @@ namespace VerifyTAPN
 
 	    ;
 	    void OutputTraceTo(const TAPN::TimedArcPetriNet & tapn) const;
+	    void Save(BinaryWriter & out) const;
+	    void Load(BinaryReader & in);
 	private:
 	    void CalculateDelays(const std::deque<TraceInfo> & traceInfos, std::vector<decimal> & delays) const;
 	    void ComputeIndexMappings(std::deque<TraceInfo> & traceInfos) const;
@@ -0,0 +1,169 @@
+#include "UntimedReachability.hpp"
+#include "QueryChecker/QueryProgram.hpp"
+#include "../HashFunctions/MurmurHash2Neutral.hpp"
+#include <map>
+#include <algorithm>
+
+namespace VerifyTAPN {
+	static void AddWeight(std::vector< std::pair<int, int> >& weights, int place)
+	{
+		std::vector< std::pair<int, int> >::iterator it = weights.begin();
+		while(it != weights.end() && it->first != place) ++it;
+		if(it == weights.end()) weights.push_back(std::make_pair(place, 1));
+		else it->second++;
+	}
+
+	UntimedReachability::UntimedReachability(const TAPN::TimedArcPetriNet& tapn, const std::vector<int>& initialPlacement, unsigned int kBound)
+		: transitions(tapn.GetNumberOfTransitions()), initialTokens(tapn.NumberOfPlaces(), 0), kBound(kBound), bits(1), wordsPerMarking(1),
+		  markings(), table(INITIAL_CAPACITY, NO_MARKING), count(0), scratch(), maxTokens(0)
+	{
+		std::map<const TAPN::TimedTransition*, unsigned int> indices;
+		for(unsigned int t = 0; t < tapn.GetTransitions().size(); t++) indices[tapn.GetTransitions()[t].get()] = t;
+
+		for(TAPN::TimedInputArc::Vector::const_iterator iter = tapn.GetInputArcs().begin(); iter != tapn.GetInputArcs().end(); ++iter)
+		{
+			AddWeight(transitions[indices[&(*iter)->OutputTransition()]].inputs, (*iter)->InputPlace().GetIndex());
+		}
+		for(TAPN::TransportArc::Vector::const_iterator iter = tapn.GetTransportArcs().begin(); iter != tapn.GetTransportArcs().end(); ++iter)
+		{
+			Transition& transition = transitions[indices[&(*iter)->Transition()]];
+			AddWeight(transition.inputs, (*iter)->Source().GetIndex());
+			AddWeight(transition.outputs, (*iter)->Destination().GetIndex());
+		}
+		for(TAPN::OutputArc::Vector::const_iterator iter = tapn.GetOutputArcs().begin(); iter != tapn.GetOutputArcs().end(); ++iter)
+		{
+			AddWeight(transitions[indices[&(*iter)->InputTransition()]].outputs, (*iter)->OutputPlace().GetIndex());
+		}
+		for(TAPN::InhibitorArc::Vector::const_iterator iter = tapn.GetInhibitorArcs().begin(); iter != tapn.GetInhibitorArcs().end(); ++iter)
+		{
+			transitions[indices[&(*iter)->OutputTransition()]].inhibitors.push_back((*iter)->InputPlace().GetIndex());
+		}
+
+		for(std::vector<Transition>::iterator t = transitions.begin(); t != transitions.end(); ++t)
+		{
+			t->change = 0;
+			for(PlaceWeights::const_iterator it = t->inputs.begin(); it != t->inputs.end(); ++it) t->change -= it->second;
+			for(PlaceWeights::const_iterator it = t->outputs.begin(); it != t->outputs.end(); ++it) t->change += it->second;
+		}
+
+		for(std::vector<int>::const_iterator iter = initialPlacement.begin(); iter != initialPlacement.end(); ++iter)
+			initialTokens[*iter]++;
+
+		while((1ull << bits) <= kBound) bits++;
+		wordsPerMarking = std::max<unsigned int>(1, (initialTokens.size() * bits + 63) / 64);
+		scratch.resize(wordsPerMarking);
+	}
+
+	bool UntimedReachability::ProvesUnreachable(const std::vector<AST::Query*>& queries, unsigned int maxMarkings)
+	{
+		std::vector< boost::shared_ptr<QueryProgram> > programs;
+		for(std::vector<AST::Query*>::const_iterator iter = queries.begin(); iter != queries.end(); ++iter)
+		{
+			if((*iter)->GetQuantifier() != AST::EF && (*iter)->GetQuantifier() != AST::AG) return false;
+			programs.push_back(boost::make_shared<QueryProgram>(**iter));
+		}
+
+		std::vector<int> tokens(initialTokens);
+		Insert(tokens);
+		for(unsigned int next = 0; next < count; next++)
+		{
+			Unpack(&markings[next * wordsPerMarking], tokens);
+			if(Settles(programs, queries, tokens)) return false;
+
+			int total = 0;
+			for(std::vector<int>::const_iterator it = tokens.begin(); it != tokens.end(); ++it) total += *it;
+			maxTokens = std::max<unsigned int>(maxTokens, total);
+
+			for(std::vector<Transition>::const_iterator t = transitions.begin(); t != transitions.end(); ++t)
+			{
+				bool enabled = true;
+				for(PlaceWeights::const_iterator it = t->inputs.begin(); it != t->inputs.end() && enabled; ++it)
+					enabled = tokens[it->first] >= it->second;
+				for(std::vector<int>::const_iterator it = t->inhibitors.begin(); it != t->inhibitors.end() && enabled; ++it)
+					enabled = tokens[*it] == 0;
+				if(!enabled) continue;
+				if(total + t->change > static_cast<int>(kBound)) return false;
+
+				for(PlaceWeights::const_iterator it = t->inputs.begin(); it != t->inputs.end(); ++it) tokens[it->first] -= it->second;
+				for(PlaceWeights::const_iterator it = t->outputs.begin(); it != t->outputs.end(); ++it) tokens[it->first] += it->second;
+				bool added = Insert(tokens);
+				for(PlaceWeights::const_iterator it = t->outputs.begin(); it != t->outputs.end(); ++it) tokens[it->first] -= it->second;
+				for(PlaceWeights::const_iterator it = t->inputs.begin(); it != t->inputs.end(); ++it) tokens[it->first] += it->second;
+
+				if(added && count > maxMarkings) return false;
+			}
+		}
+		return true;
+	}
+
+	bool UntimedReachability::Settles(const std::vector< boost::shared_ptr<QueryProgram> >& programs, const std::vector<AST::Query*>& queries, const std::vector<int>& tokens) const
+	{
+		for(unsigned int i = 0; i < programs.size(); i++)
+		{
+			bool satisfied = programs[i]->Evaluate(tokens);
+			if(satisfied == (queries[i]->GetQuantifier() == AST::EF)) return true;
+		}
+		return false;
+	}
+
+	size_t UntimedReachability::Hash(const uint64_t* words) const
+	{
+		return MurmurHashNeutral2(words, wordsPerMarking * sizeof(uint64_t), 0);
+	}
+
+	void UntimedReachability::Pack(const std::vector<int>& tokens, uint64_t* words) const
+	{
+		std::fill(words, words + wordsPerMarking, 0);
+		for(unsigned int p = 0, offset = 0; p < tokens.size(); p++, offset += bits)
+		{
+			uint64_t value = tokens[p];
+			unsigned int shift = offset % 64;
+			words[offset / 64] |= value << shift;
+			if(shift + bits > 64) words[offset / 64 + 1] |= value >> (64 - shift);
+		}
+	}
+
+	void UntimedReachability::Unpack(const uint64_t* words, std::vector<int>& tokens) const
+	{
+		const uint64_t mask = (1ull << bits) - 1;
+		for(unsigned int p = 0, offset = 0; p < tokens.size(); p++, offset += bits)
+		{
+			unsigned int shift = offset % 64;
+			uint64_t value = words[offset / 64] >> shift;
+			if(shift + bits > 64) value |= words[offset / 64 + 1] << (64 - shift);
+			tokens[p] = static_cast<int>(value & mask);
+		}
+	}
+
+	bool UntimedReachability::Insert(const std::vector<int>& tokens)
+	{
+		Pack(tokens, &scratch[0]);
+		if(2 * (count + 1) > table.size()) Grow();
+
+		size_t mask = table.size() - 1;
+		size_t i = Hash(&scratch[0]) & mask;
+		for(; table[i] != NO_MARKING; i = (i + 1) & mask)
+		{
+			if(std::equal(scratch.begin(), scratch.end(), markings.begin() + static_cast<size_t>(table[i]) * wordsPerMarking)) return false;
+		}
+		table[i] = count++;
+		markings.insert(markings.end(), scratch.begin(), scratch.end());
+		return true;
+	}
+
+	void UntimedReachability::Grow()
+	{
+		std::vector<unsigned int> old(table.size() * 2, NO_MARKING);
+		old.swap(table);
+
+		size_t mask = table.size() - 1;
+		for(std::vector<unsigned int>::const_iterator iter = old.begin(); iter != old.end(); ++iter)
+		{
+			if(*iter == NO_MARKING) continue;
+
+			size_t i = Hash(&markings[static_cast<size_t>(*iter) * wordsPerMarking]) & mask;
+			while(table[i] != NO_MARKING) i = (i + 1) & mask;
+			table[i] = *iter;
+		}
+	}
+}
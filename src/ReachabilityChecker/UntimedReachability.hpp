@@ -0,0 +1,73 @@
+#ifndef UNTIMEDREACHABILITY_HPP_
+#define UNTIMEDREACHABILITY_HPP_
+
+#include <vector>
+#include <stdint.h>
+#include "boost/smart_ptr.hpp"
+#include "../Core/TAPN/TAPN.hpp"
+#include "../Core/QueryParser/AST.hpp"
+
+namespace VerifyTAPN {
+	class QueryProgram;
+
+	// Breadth-first reachability on the untimed net: a marking is just the number
+	// of tokens in each place, and all intervals, guards and invariants are ignored
+	// (inhibitor arcs are not, they only depend on the token counts). Every marking
+	// within the k-bound that the zone-based search can reach is projected onto a
+	// marking found here, so this is an over-approximation. It does not fire
+	// transitions that would exceed k tokens; as the timed net may never get there,
+	// nothing is proved once such a firing is cut.
+	//
+	// Markings are bit-packed, with enough bits per place to count to k, and stored
+	// back to back in one array; the array order is the breadth-first order, so it
+	// doubles as the waiting list. A separate open-addressed table of indices into
+	// the array finds duplicates.
+	class UntimedReachability
+	{
+	private:
+		typedef std::vector< std::pair<int, int> > PlaceWeights; // (place, number of arcs)
+
+		struct Transition {
+			PlaceWeights inputs;
+			PlaceWeights outputs;
+			std::vector<int> inhibitors;
+			int change; // in the total number of tokens
+		};
+
+	public:
+		UntimedReachability(const TAPN::TimedArcPetriNet& tapn, const std::vector<int>& initialPlacement, unsigned int kBound);
+
+		// Explores at most maxMarkings markings and returns true if all were explored
+		// within the k-bound and none of them settles a query (satisfies the
+		// proposition of an EF query or violates that of an AG query).
+		bool ProvesUnreachable(const std::vector<AST::Query*>& queries, unsigned int maxMarkings);
+		inline unsigned int Size() const { return count; };
+		inline unsigned int MaxTokens() const { return maxTokens; };
+
+	private:
+		bool Settles(const std::vector< boost::shared_ptr<QueryProgram> >& programs, const std::vector<AST::Query*>& queries, const std::vector<int>& tokens) const;
+		size_t Hash(const uint64_t* words) const;
+		void Pack(const std::vector<int>& tokens, uint64_t* words) const;
+		void Unpack(const uint64_t* words, std::vector<int>& tokens) const;
+		bool Insert(const std::vector<int>& tokens);
+		void Grow();
+
+	private:
+		static const unsigned int NO_MARKING = ~0u;
+		static const size_t INITIAL_CAPACITY = 1 << 12; // must be a power of two
+
+		std::vector<Transition> transitions;
+		std::vector<int> initialTokens;
+		unsigned int kBound;
+		unsigned int bits; // per place
+		unsigned int wordsPerMarking;
+
+		std::vector<uint64_t> markings;
+		std::vector<unsigned int> table; // linear probing, kept at most half full
+		unsigned int count;
+		std::vector<uint64_t> scratch;
+		unsigned int maxTokens; // in any explored marking
+	};
+}
+
+#endif /* UNTIMEDREACHABILITY_HPP_ */
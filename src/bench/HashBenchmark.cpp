@@ -0,0 +1,178 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <deque>
+#include <set>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include "boost/smart_ptr.hpp"
+#include "../Core/TAPNParser/TAPNXmlParser.hpp"
+#include "../Core/VerificationOptions.hpp"
+#include "../Core/SymbolicMarking/UppaalDBMMarkingFactory.hpp"
+#include "../ReachabilityChecker/SuccessorGenerator.hpp"
+#include "../HashFunctions/PlacementHash.hpp"
+
+// Compares the placement hash functions on placements reachable in a real net.
+//
+//   verifytapn-hashbench <k-bound> <max placements> model-file
+//
+// The placements are collected by a breadth-first search that expands every
+// (sorted) placement once, ignoring the zones. For every hash function it prints
+// the hashing throughput and how evenly the placements spread over a table with
+// one bucket per placement (rounded up to a power of two): the fraction of empty
+// buckets, the longest chain and the number of colliding pairs relative to the
+// number expected from a uniform hash (so ideally close to 1). The empty fraction
+// expected from a uniform hash is printed above the table.
+using namespace VerifyTAPN;
+
+typedef std::vector<int> Placement;
+typedef size_t (*PlacementHashFunction)(const std::vector<int>&, size_t);
+
+volatile size_t sink; // keeps the timed loop from being optimized away
+
+std::vector<Placement> CollectPlacements(const boost::shared_ptr<TAPN::TimedArcPetriNet>& tapn, const std::vector<int>& initialPlacement, unsigned int kBound, unsigned int maxPlacements)
+{
+	VerificationOptions options("", "", BREADTHFIRST, kBound, false, NONE, false, true, false, OLD_FACTORY, std::vector<std::string>(), 0, false, 0, false, NO_STATISTICS, false, false, 0, 0, false, false, 0);
+	UppaalDBMMarkingFactory factory(tapn);
+	SuccessorGenerator succGen(*tapn, factory, options, initialPlacement.size());
+
+	std::vector<Placement> placements;
+	std::set<Placement> seen;
+	std::deque<SymbolicMarking*> queue;
+
+	SymbolicMarking* initial = factory.InitialMarking(initialPlacement);
+	initial->Delay();
+	queue.push_back(initial);
+
+	std::vector<Successor> successors;
+	while(!queue.empty() && placements.size() < maxPlacements)
+	{
+		SymbolicMarking* next = queue.front();
+		queue.pop_front();
+
+		Placement placement;
+		for(unsigned int i = 0; i < next->NumberOfTokens(); i++) placement.push_back(next->GetTokenPlacement(i));
+		std::sort(placement.begin(), placement.end());
+
+		if(!seen.insert(placement).second)
+		{
+			factory.Recycle(next);
+			continue;
+		}
+		placements.push_back(placement);
+
+		succGen.GenerateDiscreteTransitionsSuccessors(*next, successors);
+		for(std::vector<Successor>::iterator iter = successors.begin(); iter != successors.end(); ++iter)
+		{
+			iter->Marking()->Delay();
+			queue.push_back(iter->Marking());
+		}
+		successors.clear();
+		factory.Recycle(next);
+	}
+
+	for(std::deque<SymbolicMarking*>::iterator iter = queue.begin(); iter != queue.end(); ++iter) factory.Recycle(*iter);
+	return placements;
+}
+
+void Measure(const std::string& name, PlacementHashFunction hash, const std::vector<Placement>& placements)
+{
+	size_t buckets = 1;
+	while(buckets < placements.size()) buckets <<= 1;
+
+	std::vector<unsigned int> load(buckets, 0);
+	std::vector<size_t> hashes;
+	hashes.reserve(placements.size());
+	for(std::vector<Placement>::const_iterator iter = placements.begin(); iter != placements.end(); ++iter)
+	{
+		size_t h = hash(*iter, 0);
+		hashes.push_back(h);
+		load[h & (buckets - 1)]++;
+	}
+
+	size_t empty = 0;
+	unsigned int longest = 0;
+	double pairs = 0;
+	for(std::vector<unsigned int>::const_iterator iter = load.begin(); iter != load.end(); ++iter)
+	{
+		if(*iter == 0) empty++;
+		longest = std::max(longest, *iter);
+		pairs += 0.5 * (*iter) * ((*iter) - 1.0);
+	}
+	double n = placements.size();
+	double expectedPairs = n * (n - 1) / (2.0 * buckets);
+
+	std::sort(hashes.begin(), hashes.end());
+	size_t fullCollisions = hashes.size() - (std::unique(hashes.begin(), hashes.end()) - hashes.begin());
+
+	size_t bytes = 0;
+	for(std::vector<Placement>::const_iterator iter = placements.begin(); iter != placements.end(); ++iter) bytes += iter->size() * sizeof(int);
+
+	size_t checksum = 0;
+	long long rounds = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	double seconds = 0;
+	do
+	{
+		for(std::vector<Placement>::const_iterator iter = placements.begin(); iter != placements.end(); ++iter)
+			checksum ^= hash(*iter, 0);
+		rounds++;
+		seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	} while(seconds < 0.5);
+	sink = checksum;
+
+	double hashed = rounds * n;
+	std::cout << std::left << std::setw(8) << name << std::right << std::fixed
+		<< std::setw(12) << std::setprecision(1) << seconds * 1e9 / hashed
+		<< std::setw(12) << std::setprecision(0) << rounds * bytes / seconds / (1024 * 1024)
+		<< std::setw(10) << std::setprecision(3) << empty / static_cast<double>(buckets)
+		<< std::setw(10) << longest
+		<< std::setw(12) << std::setprecision(3) << (expectedPairs > 0 ? pairs / expectedPairs : 0)
+		<< std::setw(12) << fullCollisions << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	if(argc != 4)
+	{
+		std::cout << "Usage: verifytapn-hashbench <k-bound> <max placements> model-file" << std::endl;
+		return 1;
+	}
+	unsigned int kBound = atoi(argv[1]);
+	unsigned int maxPlacements = atoi(argv[2]);
+	std::string modelFile(argv[3]);
+
+	TAPNXmlParser modelParser;
+	boost::shared_ptr<TAPN::TimedArcPetriNet> tapn;
+	try{
+		tapn = modelParser.Parse(modelFile);
+	}catch(const std::string& e){
+		std::cout << "There was an error parsing the model file: " << e << std::endl;
+		return 1;
+	}
+	tapn->Initialize(true);
+	std::vector<int> initialPlacement(modelParser.ParseMarking(modelFile, *tapn));
+	if(initialPlacement.size() > kBound)
+	{
+		std::cout << "The specified k-bound is less than the number of tokens in the initial markings." << std::endl;
+		return 1;
+	}
+
+	std::vector<Placement> placements = CollectPlacements(tapn, initialPlacement, kBound, maxPlacements);
+	size_t tokens = 0;
+	for(std::vector<Placement>::const_iterator iter = placements.begin(); iter != placements.end(); ++iter) tokens += iter->size();
+
+	size_t buckets = 1;
+	while(buckets < placements.size()) buckets <<= 1;
+	std::cout << placements.size() << " placements, " << std::setprecision(3) << tokens / static_cast<double>(std::max<size_t>(placements.size(), 1)) << " tokens on average, "
+		<< buckets << " buckets (uniform hash: " << std::exp(-static_cast<double>(placements.size()) / buckets) << " empty)" << std::endl;
+	std::cout << std::left << std::setw(8) << "hash" << std::right << std::setw(12) << "ns/hash" << std::setw(12) << "MB/s"
+		<< std::setw(10) << "empty" << std::setw(10) << "longest" << std::setw(12) << "pairs/exp" << std::setw(12) << "collisions" << std::endl;
+	Measure("boost", &BoostPlacementHash, placements);
+	Measure("murmur", &MurmurPlacementHash, placements);
+	Measure("word", &WordPlacementHash, placements);
+	return 0;
+}
@@ -1,19 +1,27 @@
 #include <iostream>
+#include <fstream>
+#include <sstream>
 #include "boost/smart_ptr.hpp"
 #include "Core/TAPNParser/TAPNXmlParser.hpp"
 #include "Core/VerificationOptions.hpp"
 #include "Core/ArgsParser.hpp"
+#include "Core/Profiler.hpp"
 #include "Core/QueryParser/UpwardClosedVisitor.hpp"
 #include "Core/QueryParser/TAPNQueryParser.hpp"
 #include "Core/QueryParser/NormalizationVisitor.hpp"
 #include "Core/QueryParser/ToStringVisitor.hpp"
 #include "Core/QueryParser/BadPlaceVisitor.hpp"
+#include "Core/QueryParser/VisiblePlacesVisitor.hpp"
 
 #include "ReachabilityChecker/Search/SearchStrategy.hpp"
 #include "ReachabilityChecker/Search/BFS.hpp"
 #include "ReachabilityChecker/Search/DFS.hpp"
 #include "ReachabilityChecker/Search/CoverMostSearch.hpp"
 #include "ReachabilityChecker/Search/RandomSearch.hpp"
+#include "ReachabilityChecker/Search/QueryDistanceSearch.hpp"
+#include "ReachabilityChecker/Search/LivenessSearch.hpp"
+#include "ReachabilityChecker/StateEquation.hpp"
+#include "ReachabilityChecker/UntimedReachability.hpp"
 
 #include "Core/SymbolicMarking/UppaalDBMMarkingFactory.hpp"
 #include "Core/SymbolicMarking/DiscreteInclusionMarkingFactory.hpp"
@@ -37,9 +45,54 @@ MarkingFactory* CreateFactory(const VerificationOptions& options, const boost::s
 	};
 }
 
-SearchStrategy* CreateSearchStrategy(const boost::shared_ptr<TAPN::TimedArcPetriNet>& tapn, SymbolicMarking* initialMarking, AST::Query* query, const VerificationOptions& options, MarkingFactory* factory)
+bool IsLiveness(const AST::Query& query)
+{
+	return query.GetQuantifier() == AST::EG || query.GetQuantifier() == AST::AF;
+}
+
+// EG and AF queries are verified by their own search on the whole net, which
+// supports none of the options below. Returns false, saying why, if one is set.
+bool HasStrictInvariant(const TAPN::TimedArcPetriNet& tapn)
+{
+	const TAPN::TimedPlace::Vector& places = tapn.GetPlaces();
+	for(TAPN::TimedPlace::Vector::const_iterator iter = places.begin(); iter != places.end(); ++iter)
+	{
+		const TAPN::TimeInvariant& invariant = (*iter)->GetInvariant();
+		if(invariant != TAPN::TimeInvariant::LS_INF && invariant.IsBoundStrict()) return true;
+	}
+	return false;
+}
+
+// A time-lock at a strict invariant is never reached, the run delays towards the bound
+// forever instead, which the liveness search does not detect.
+bool CheckLivenessOptions(const TAPN::TimedArcPetriNet& tapn, const std::vector<AST::Query*>& queries, const VerificationOptions& options)
+{
+	std::string unsupported;
+	if(queries.size() > 1) unsupported = "Verifying several queries at once";
+	else if(HasStrictInvariant(tapn)) unsupported = "A place invariant with a strict bound (<)";
+	else if(options.GetTrace() != NONE) unsupported = "Generating traces";
+	else if(options.GetFactory() == DISCRETE_INCLUSION) unsupported = "Discrete inclusion";
+	else if(options.GetPartialOrderReductionEnabled()) unsupported = "Partial order reduction";
+	else if(options.GetSlicingEnabled()) unsupported = "Slicing";
+	else if(options.GetCheckpointInterval() > 0 || options.Resume()) unsupported = "Checkpointing";
+	else return true;
+
+	std::cout << unsupported << " is not supported for EG and AF queries." << std::endl;
+	return false;
+}
+
+// The search is guided by (and traces are generated for) the first query, the others are checked along.
+SearchStrategy* CreateSearchStrategy(const boost::shared_ptr<TAPN::TimedArcPetriNet>& tapn, SymbolicMarking* initialMarking, const std::vector<AST::Query*>& queries, const VerificationOptions& options, MarkingFactory* factory)
 {
 	SearchStrategy* strategy;
+	AST::Query* query = queries[0];
+
+	if(IsLiveness(*query))
+	{
+		strategy = new LivenessSearch(*tapn, initialMarking, query, options, factory);
+		strategy->Init();
+		return strategy;
+	}
 
 	switch(options.GetSearchType())
 	{
@@ -55,14 +108,32 @@ SearchStrategy* CreateSearchStrategy(const boost::shared_ptr<TAPN::TimedArcPetri
 	case RANDOM:
 		strategy = new RandomSearch(*tapn, initialMarking, query, options, factory);
 		break;
+	case QUERYDISTANCE:
+		strategy = new QueryDistanceSearch(*tapn, initialMarking, query, options, factory);
+		break;
 	default:
 		strategy = new BFS(*tapn, initialMarking, query, options, factory);
 		break;
 	}
+	for(unsigned int i = 1; i < queries.size(); i++)
+		strategy->AddQuery(queries[i]);
 	strategy->Init();
 	return strategy;
 }
 
+void PrintQueryResults(const boost::shared_ptr<TAPN::TimedArcPetriNet>& tapn, const std::vector<AST::Query*>& queries, const std::vector<QueryResult>& results)
+{
+	AST::ToStringVisitor visitor(tapn);
+	for(unsigned int i = 0; i < queries.size(); i++)
+	{
+		std::cout << "Query " << i + 1 << " (";
+		visitor.Print(*queries[i]);
+		std::cout << ") is " << (results[i].satisfied ? "satisfied" : "NOT satisfied") << ", decided after "
+			<< results[i].stats.exploredStates << " explored and " << results[i].stats.storedStates << " stored markings ("
+			<< results[i].seconds << " s)." << std::endl;
+	}
+}
+
 void FixIncSet(const TimedArcPetriNet& tapn, VerificationOptions& options){
 	std::vector<std::string>& inc = options.GetIncPlaces();
 	if(inc.size() == 1 && inc[0] == "*NONE*"){
@@ -90,6 +161,84 @@ void RemoveBadPlacesFromINC(const AST::Query& normalizedQuery, const TimedArcPet
 	}
 }
 
+// Replaces the net by its cone of influence with respect to the places in the
+// queries. The initial marking is left unchanged.
+void SliceNet(boost::shared_ptr<TAPN::TimedArcPetriNet>& tapn, const std::vector<AST::Query*>& queries)
+{
+	AST::VisiblePlacesVisitor visitor;
+	for(std::vector<AST::Query*>::const_iterator iter = queries.begin(); iter != queries.end(); ++iter)
+		visitor.FindVisiblePlaces(**iter);
+
+	std::vector<bool> relevant;
+	boost::shared_ptr<TAPN::TimedArcPetriNet> sliced = tapn->Slice(visitor.GetVisiblePlaces(), relevant);
+
+	std::cout << "Slicing kept " << std::count(relevant.begin(), relevant.end(), true) << " of " << relevant.size() << " places and "
+		<< sliced->GetNumberOfTransitions() << " of " << tapn->GetNumberOfTransitions() << " transitions." << std::endl << std::endl;
+	tapn = sliced;
+}
+
+void PrintMaxTokens(unsigned int maxTokens, const VerificationOptions& options)
+{
+	std::cout << "Max number of tokens found in any reachable marking: ";
+	if(maxTokens == options.GetKBound() + 1)
+		std::cout << ">" << options.GetKBound() << std::endl;
+	else
+		std::cout << maxTokens << std::endl;
+}
+
+// Prints the answers when no marking within the k-bound can settle any of the
+// queries: EF queries are not satisfied and AG queries are. No max number of
+// tokens is printed, as it depends on the method; see the callers.
+void PrintUnsettledAnswers(const boost::shared_ptr<TAPN::TimedArcPetriNet>& tapn, const std::vector<AST::Query*>& queries, const VerificationOptions& options, const std::string& method)
+{
+	std::cout << options << std::endl;
+	if(queries.size() == 1)
+	{
+		std::cout << "Query is " << (queries[0]->GetQuantifier() == AST::AG ? "satisfied" : "NOT satisfied") << "." << std::endl;
+	}
+	else
+	{
+		AST::ToStringVisitor visitor(tapn);
+		for(unsigned int i = 0; i < queries.size(); i++)
+		{
+			std::cout << "Query " << i + 1 << " (";
+			visitor.Print(*queries[i]);
+			std::cout << ") is " << (queries[i]->GetQuantifier() == AST::AG ? "satisfied" : "NOT satisfied") << "." << std::endl;
+		}
+	}
+	std::cout << "Answered by " << method << "." << std::endl;
+}
+
+// Answers the queries without a search if the state equation shows that none of
+// them can be settled by any reachable marking, whatever the k-bound. Returns
+// false if any query needs the search. No marking is explored, so nothing is
+// known about the number of tokens and no max is printed.
+bool AnsweredByStateEquation(const boost::shared_ptr<TAPN::TimedArcPetriNet>& tapn, const std::vector<int>& initialPlacement, const std::vector<AST::Query*>& queries, const VerificationOptions& options)
+{
+	StateEquation stateEquation(*tapn, initialPlacement);
+	for(std::vector<AST::Query*>::const_iterator iter = queries.begin(); iter != queries.end(); ++iter)
+	{
+		if(!stateEquation.ProvesUnreachable(**iter)) return false;
+	}
+	PrintUnsettledAnswers(tapn, queries, options, "structural analysis (state equation)");
+	return true;
+}
+
+// Same, if no marking of the untimed net settles any of the queries. The pass
+// gives up as soon as a firing would exceed the k-bound, so the max printed is
+// within k; it is that of the untimed net, at least the max of the timed one.
+bool AnsweredByUntimedNet(const boost::shared_ptr<TAPN::TimedArcPetriNet>& tapn, const std::vector<int>& initialPlacement, const std::vector<AST::Query*>& queries, const VerificationOptions& options)
+{
+	UntimedReachability untimed(*tapn, initialPlacement, options.GetKBound());
+	if(!untimed.ProvesUnreachable(queries, options.GetUntimedMarkings())) return false;
+
+	std::stringstream method;
+	method << "exploring the untimed net (" << untimed.Size() << " markings)";
+	PrintUnsettledAnswers(tapn, queries, options, method.str());
+	PrintMaxTokens(untimed.MaxTokens(), options);
+	return true;
+}
+
 int main(int argc, char* argv[])
 {
 	srand ( time(NULL) );
@@ -106,25 +255,60 @@ int main(int argc, char* argv[])
 		std::cout << "There was an error parsing the model file: " << e << std::endl;
 		return 1;
 	}
-	tapn->Initialize(options.GetUntimedPlacesEnabled());
 	std::vector<int> initialPlacement(modelParser.ParseMarking(options.GetInputFile(), *tapn));
 
-	AST::Query* query;
+	std::vector<AST::Query*> queries;
+	bool parsed = false;
 	try{
 		TAPNQueryParser queryParser(*tapn);
-		queryParser.parse(options.QueryFile());
-		query = queryParser.GetAST();
+		parsed = queryParser.parse(options.QueryFile()) == 0;
+		queries = queryParser.GetQueries();
 	}catch(...){
 		std::cout << "There was an error parsing the query file." << std::endl;
 		return 1;
 	}
+	if(!parsed || queries.empty())
+	{
+		// the queries before a malformed one were parsed, but none of them is verified
+		for(std::vector<AST::Query*>::iterator iter = queries.begin(); iter != queries.end(); ++iter)
+			delete *iter;
+		std::cout << "There was an error parsing the query file." << std::endl;
+		return 1;
+	}
+	if(queries.size() > 1 && options.GetTrace() != NONE)
+	{
+		std::cout << "Traces can only be generated for a single query." << std::endl;
+		return 1;
+	}
+
+	bool liveness = false;
+	for(std::vector<AST::Query*>::const_iterator iter = queries.begin(); iter != queries.end(); ++iter)
+		liveness = liveness || IsLiveness(**iter);
+	if(liveness && !CheckLivenessOptions(*tapn, queries, options)) return 1;
+
+	if(options.GetSlicingEnabled())
+		SliceNet(tapn, queries);
+	tapn->Initialize(options.GetUntimedPlacesEnabled());
+	// abstracting the ages of tokens that cannot influence the queries may let a trace
+	// fire transitions whose guards the concrete ages do not satisfy, and a maximal
+	// run may consist of such transitions only
+	if(options.GetTimeIrrelevantPlacesEnabled() && options.GetUntimedPlacesEnabled() && options.GetTrace() == NONE && !liveness)
+	{
+		AST::VisiblePlacesVisitor visitor;
+		for(std::vector<AST::Query*>::const_iterator iter = queries.begin(); iter != queries.end(); ++iter)
+			visitor.FindVisiblePlaces(**iter);
+		tapn->MarkTimeIrrelevantPlaces(visitor.GetVisiblePlaces());
+	}
 
 	if(options.GetFactory() == DISCRETE_INCLUSION)
 	{
 		AST::NormalizationVisitor visitor;
-		AST::Query* normalized = visitor.Normalize(*query);
-		RemoveBadPlacesFromINC(*normalized, *tapn, options);
-		delete normalized;
+		for(std::vector<AST::Query*>::const_iterator iter = queries.begin(); iter != queries.end(); ++iter)
+		{
+			AST::Query* normalized = visitor.Normalize(**iter);
+			RemoveBadPlacesFromINC(*normalized, *tapn, options);
+			delete normalized;
+		}
 		/*AST::UpwardClosedVisitor visitor;
 		bool upward_closed = visitor.IsUpwardClosed(*query);
 		if(!upward_closed)
@@ -143,18 +327,41 @@ int main(int argc, char* argv[])
 		return 1;
 	}
 
-	SearchStrategy* strategy = CreateSearchStrategy(tapn, initialMarking, query, options, factory);
+	if((options.GetStateEquationEnabled() && AnsweredByStateEquation(tapn, initialPlacement, queries, options))
+		|| (options.GetUntimedMarkings() > 0 && AnsweredByUntimedNet(tapn, initialPlacement, queries, options)))
+	{
+		factory->Release(initialMarking);
+		delete factory;
+		for(std::vector<AST::Query*>::iterator iter = queries.begin(); iter != queries.end(); ++iter)
+			delete *iter;
+		return 0;
+	}
+
+	SearchStrategy* strategy = CreateSearchStrategy(tapn, initialMarking, queries, options, factory);
 
 	std::cout << options << std::endl;
-	bool result = strategy->Verify();
+	if(liveness) std::cout << "Searching depth-first for a maximal run (EG/AF query); infinite runs need not be time divergent" << std::endl;
+	bool result;
+	try{
+		result = strategy->Verify();
+	}catch(const std::string& e){
+		std::cout << "There was an error resuming from the checkpoint: " << e << std::endl;
+		return 1;
+	}
 	std::cout << strategy->GetStats() << std::endl;
 	strategy->PrintTransitionStatistics();
-	std::cout << "Query is " << (result ? "satisfied" : "NOT satisfied") << "." << std::endl;
-	std::cout << "Max number of tokens found in any reachable marking: ";
-	if(strategy->MaxUsedTokens() == options.GetKBound() + 1)
-		std::cout << ">" << options.GetKBound() << std::endl;
+	if(options.GetStatisticsFormat() != NO_STATISTICS)
+	{
+		std::ofstream statistics(options.StatisticsFile().c_str());
+		if(statistics) strategy->ExportTransitionStatistics(statistics, options.GetStatisticsFormat());
+		else std::cout << "Could not write transition statistics to " << options.StatisticsFile() << std::endl;
+	}
+	PROFILE_PRINT(std::cout);
+	if(queries.size() == 1)
+		std::cout << "Query is " << (result ? "satisfied" : "NOT satisfied") << "." << std::endl;
 	else
-		std::cout << strategy->MaxUsedTokens() << std::endl;
+		PrintQueryResults(tapn, queries, strategy->GetQueryResults());
+	PrintMaxTokens(strategy->MaxUsedTokens(), options);
 
 	try{
 		strategy->PrintTraceIfAny(result);
@@ -163,7 +370,7 @@ int main(int argc, char* argv[])
 		std::cout << e.what() << std::endl;
 		return 1;
 	}
-	delete strategy;
+	delete strategy; // its query checkers own the queries
 	delete factory;
 
 	return 0;